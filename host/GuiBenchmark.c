@@ -0,0 +1,432 @@
+// Project includes
+#include "GuiSensorData.h"
+#include "Screens/LvglRpmScreen.h"
+#include "Screens/LvglSpeedScreen.h"
+#include "Screens/LvglTemperatureScreen.h"
+#include "SensorSnapshot.h"
+
+// C includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// LVGL includes
+#include "lvgl.h"
+
+/*
+ *	Private defines
+ */
+#define LCD_RESOLUTION 240
+#define LCD_BIT_DEPTH 16
+#define LCD_BYTE_DEPTH (LCD_BIT_DEPTH / 8)
+#define FRAME_BUFFER_SIZE_B (LCD_RESOLUTION * LCD_RESOLUTION * LCD_BYTE_DEPTH)
+
+#define DEFAULT_FRAME_AMOUNT 300
+#define DEFAULT_FRAME_PERIOD_MS 16
+#define DEFAULT_SAMPLE_PERIOD_MS 100
+#define REPLAY_LINE_LENGTH 256
+
+/*
+ *	Private typedefs
+ */
+//! \brief What happened while rendering a single frame
+typedef struct
+{
+	//! \brief Time spent in lv_refr_now() including the flushes
+	uint64_t renderUs;
+
+	//! \brief Time spent copying into the framebuffer
+	uint64_t flushUs;
+
+	//! \brief Amount of flush_cb calls
+	uint32_t flushCalls;
+
+	//! \brief Amount of pixels handed to flush_cb
+	uint32_t pixelsFlushed;
+
+	//! \brief Bounding box of all flushed areas
+	lv_area_t dirtyArea;
+} FrameStatistics_t;
+
+/*
+ *	Prototypes
+ */
+//! \brief Returns a monotonic timestamp in us
+//! \retval The timestamp in us
+static uint64_t getTimeUs();
+
+//! \brief Tick source of LVGL
+//! \retval The time since start in ms
+static uint32_t getLvglTickMs();
+
+//! \brief Copies the rendered area into the in-memory framebuffer
+//! \param p_display The LVGL display
+//! \param p_area The area which was rendered
+//! \param p_pxMap The rendered pixels
+static void flushPixelsToFramebuffer(lv_display_t* p_display, const lv_area_t* p_area, uint8_t* p_pxMap);
+
+//! \brief Builds and shows the requested screen
+//! \param screen The screen to show
+//! \retval Bool indicating if the screen was created
+static bool createScreen(Screen_t screen);
+
+//! \brief Parses the screen name given on the command line
+//! \param p_name The name of the screen
+//! \retval The screen or SCREEN_UNKNOWN
+static Screen_t parseScreen(const char* p_name);
+
+//! \brief Fills the next sensor data frame with synthetic values sweeping all ranges
+//! \param sample The number of the sensor data frame
+//! \param p_buffer Where the sensor data is written to
+static void generateSensorData(uint32_t sample, uint8_t* p_buffer);
+
+//! \brief Reads the sensor data of the next frame from a replay file
+//! \param p_file The replay file
+//! \param p_buffer Where the sensor data is written to
+//! \retval Bool indicating if a frame was read
+static bool readSensorData(FILE* p_file, uint8_t* p_buffer);
+
+//! \brief Renders the pending changes and collects the statistics of the frame
+//! \param p_statistics Where the statistics are written to
+static void renderFrame(FrameStatistics_t* p_statistics);
+
+//! \brief Prints the usage of the benchmark
+//! \param p_name Name of the executable
+static void printUsage(const char* p_name);
+
+/*
+ *	Private variables
+ */
+//! \brief The in-memory framebuffer replacing the GC9A01
+static uint16_t g_framebuffer[LCD_RESOLUTION * LCD_RESOLUTION];
+
+//! \brief Statistics of the frame which is currently rendered
+static FrameStatistics_t* g_currentFrameStatistics = NULL;
+
+//! \brief The shimmed semaphore guarding LVGL
+static HostSemaphore_t g_lvglGuiSemaphoreStorage = {0};
+static SemaphoreHandle_t g_lvglGuiSemaphore = &g_lvglGuiSemaphoreStorage;
+
+/*
+ *	Public variables
+ */
+//! \brief Simulated time read by the esp_timer shim
+int64_t g_hostTimeUs = 0;
+
+/*
+ *	Private function implementations
+ */
+static uint64_t getTimeUs()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
+static uint32_t getLvglTickMs()
+{
+	return (uint32_t)(g_hostTimeUs / 1000);
+}
+
+static void flushPixelsToFramebuffer(lv_display_t* p_display, const lv_area_t* p_area, uint8_t* p_pxMap)
+{
+	const uint64_t startUs = getTimeUs();
+
+	// Copy the area line by line into the framebuffer
+	const int32_t width = lv_area_get_width(p_area);
+	const uint16_t* p_source = (const uint16_t*)p_pxMap;
+	for (int32_t y = p_area->y1; y <= p_area->y2; y++) {
+		memcpy(&g_framebuffer[y * LCD_RESOLUTION + p_area->x1], p_source, width * LCD_BYTE_DEPTH);
+		p_source += width;
+	}
+
+	// Collect the statistics
+	if (g_currentFrameStatistics != NULL) {
+		if (g_currentFrameStatistics->flushCalls == 0) {
+			lv_area_copy(&g_currentFrameStatistics->dirtyArea, p_area);
+		}
+		else {
+			lv_area_join(&g_currentFrameStatistics->dirtyArea, &g_currentFrameStatistics->dirtyArea, p_area);
+		}
+
+		g_currentFrameStatistics->flushCalls++;
+		g_currentFrameStatistics->pixelsFlushed += lv_area_get_size(p_area);
+		g_currentFrameStatistics->flushUs += getTimeUs() - startUs;
+	}
+
+	lv_display_flush_ready(p_display);
+}
+
+static bool createScreen(const Screen_t screen)
+{
+	switch (screen) {
+		case SCREEN_TEMPERATURE:
+			return guiCreateTemperatureScreen(&g_lvglGuiSemaphore) && guiShowTemperatureScreen(&g_lvglGuiSemaphore);
+		case SCREEN_SPEED:
+			return guiCreateSpeedScreen(&g_lvglGuiSemaphore) && guiShowSpeedScreen(&g_lvglGuiSemaphore);
+		case SCREEN_RPM:
+			return guiCreateRpmScreen(&g_lvglGuiSemaphore) && guiShowRpmScreen(&g_lvglGuiSemaphore);
+		default:
+			return false;
+	}
+}
+
+static Screen_t parseScreen(const char* p_name)
+{
+	if (strcmp(p_name, "temperature") == 0) {
+		return SCREEN_TEMPERATURE;
+	}
+	if (strcmp(p_name, "speed") == 0) {
+		return SCREEN_SPEED;
+	}
+	if (strcmp(p_name, "rpm") == 0) {
+		return SCREEN_RPM;
+	}
+
+	return SCREEN_UNKNOWN;
+}
+
+static void generateSensorData(const uint32_t sample, uint8_t* p_buffer)
+{
+	// Same layout as res/can/SensorData.dbc
+	const uint16_t rpm = (sample * 37) % 8000;
+	p_buffer[0] = sample % 200;
+	p_buffer[1] = (uint8_t)(rpm >> 8);
+	p_buffer[2] = (uint8_t)rpm;
+	p_buffer[3] = 100 - (sample % 101);
+	p_buffer[4] = 40 + (sample % 80);
+	p_buffer[5] = (sample / 64) % 2;
+	p_buffer[6] = (sample / 16) % 2;
+	p_buffer[7] = (sample / 16) % 2;
+}
+
+static bool readSensorData(FILE* p_file, uint8_t* p_buffer)
+{
+	char line[REPLAY_LINE_LENGTH];
+	while (fgets(line, sizeof(line), p_file) != NULL) {
+		// Skip comments and empty lines
+		char* p_cursor = line;
+		while (*p_cursor == ' ' || *p_cursor == '\t') {
+			p_cursor++;
+		}
+		if (*p_cursor == '#' || *p_cursor == '\n' || *p_cursor == '\r' || *p_cursor == '\0') {
+			continue;
+		}
+
+		// Up to 8 bytes, decimal or hex with 0x prefix. Missing bytes are zero
+		memset(p_buffer, 0, SENSOR_SNAPSHOT_BUFFER_LENGTH_B);
+		for (uint8_t i = 0; i < SENSOR_SNAPSHOT_BUFFER_LENGTH_B; i++) {
+			char* p_end = NULL;
+			const unsigned long value = strtoul(p_cursor, &p_end, 0);
+			if (p_end == p_cursor) {
+				break;
+			}
+
+			p_buffer[i] = (uint8_t)value;
+			p_cursor = p_end;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+static void renderFrame(FrameStatistics_t* p_statistics)
+{
+	memset(p_statistics, 0, sizeof(FrameStatistics_t));
+	g_currentFrameStatistics = p_statistics;
+
+	const uint64_t startUs = getTimeUs();
+	lv_refr_now(NULL);
+	p_statistics->renderUs = getTimeUs() - startUs;
+
+	g_currentFrameStatistics = NULL;
+}
+
+static void printUsage(const char* p_name)
+{
+	fprintf(stderr,
+			"Usage: %s [--screen temperature|speed|rpm] [--frames N] [--frame-ms N] [--sample-ms N] [--replay FILE]"
+			" [--full-redraw] [--dump FILE]\n"
+			"  --screen     Screen to render, default rpm\n"
+			"  --frames     Amount of rendered frames, default %d. Ignored with --replay\n"
+			"  --frame-ms   Simulated time between two rendered frames, default %d\n"
+			"  --sample-ms  Simulated time between two sensor data frames, default %d\n"
+			"  --replay     File with one sensor data frame per line, 8 bytes decimal or 0x hex\n"
+			"  --full-redraw Redraws the whole screen every frame instead of the changed areas\n"
+			"  --dump       Writes the final framebuffer as raw RGB565\n",
+			p_name, DEFAULT_FRAME_AMOUNT, DEFAULT_FRAME_PERIOD_MS, DEFAULT_SAMPLE_PERIOD_MS);
+}
+
+/*
+ *	Main
+ */
+int main(int argc, char** argv)
+{
+	Screen_t screen = SCREEN_RPM;
+	uint32_t frameAmount = DEFAULT_FRAME_AMOUNT;
+	uint32_t framePeriodMs = DEFAULT_FRAME_PERIOD_MS;
+	uint32_t samplePeriodMs = DEFAULT_SAMPLE_PERIOD_MS;
+	const char* p_replayPath = NULL;
+	const char* p_dumpPath = NULL;
+	bool fullRedraw = false;
+
+	// Parse the arguments
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--screen") == 0 && i + 1 < argc) {
+			screen = parseScreen(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+			frameAmount = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--frame-ms") == 0 && i + 1 < argc) {
+			framePeriodMs = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--sample-ms") == 0 && i + 1 < argc) {
+			samplePeriodMs = (uint32_t)strtoul(argv[++i], NULL, 0);
+		}
+		else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+			p_replayPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "--full-redraw") == 0) {
+			fullRedraw = true;
+		}
+		else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) {
+			p_dumpPath = argv[++i];
+		}
+		else {
+			printUsage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (screen == SCREEN_UNKNOWN) {
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	FILE* p_replayFile = NULL;
+	if (p_replayPath != NULL) {
+		p_replayFile = fopen(p_replayPath, "r");
+		if (p_replayFile == NULL) {
+			fprintf(stderr, "Couldn't open replay file '%s'\n", p_replayPath);
+			return 1;
+		}
+	}
+
+	// Initialize LVGL like the firmware does, only the flush goes into memory
+	lv_init();
+	lv_tick_set_cb(getLvglTickMs);
+
+	lv_display_t* p_display = lv_display_create(LCD_RESOLUTION, LCD_RESOLUTION);
+	void* p_drawBuffer1 = malloc(FRAME_BUFFER_SIZE_B);
+	void* p_drawBuffer2 = malloc(FRAME_BUFFER_SIZE_B);
+	if (p_display == NULL || p_drawBuffer1 == NULL || p_drawBuffer2 == NULL) {
+		fprintf(stderr, "Couldn't create the display\n");
+		return 1;
+	}
+
+	lv_display_set_buffers(p_display, p_drawBuffer1, p_drawBuffer2, FRAME_BUFFER_SIZE_B,
+						   LV_DISPLAY_RENDER_MODE_PARTIAL);
+	lv_display_set_color_format(p_display, LV_COLOR_FORMAT_RGB565);
+	lv_obj_set_style_bg_color(lv_display_get_screen_active(p_display), lv_color_hex(0x000000), LV_PART_MAIN);
+	lv_display_set_flush_cb(p_display, flushPixelsToFramebuffer);
+
+	if (!createScreen(screen)) {
+		fprintf(stderr, "Couldn't create the screen\n");
+		return 1;
+	}
+
+	// The first frame draws the whole screen, report it separately
+	FrameStatistics_t statistics;
+	renderFrame(&statistics);
+	fprintf(stderr, "Initial frame: %llu us, %u pixels flushed\n", (unsigned long long)statistics.renderUs,
+			statistics.pixelsFlushed);
+
+	// Replay the sensor data
+	printf("frame,render_us,flush_us,flush_calls,pixels_flushed,dirty_x1,dirty_y1,dirty_x2,dirty_y2\n");
+
+	uint64_t totalRenderUs = 0;
+	uint64_t minRenderUs = UINT64_MAX;
+	uint64_t maxRenderUs = 0;
+	uint64_t totalPixelsFlushed = 0;
+	uint32_t frame = 0;
+	uint32_t sample = 0;
+	int64_t nextSampleUs = g_hostTimeUs;
+	while (p_replayFile != NULL || frame < frameAmount) {
+		g_hostTimeUs += (int64_t)framePeriodMs * 1000;
+
+		// Sensor data arrives at its own rate, the frames in between show interpolated values
+		if (g_hostTimeUs >= nextSampleUs) {
+			uint8_t buffer[SENSOR_SNAPSHOT_BUFFER_LENGTH_B];
+			if (p_replayFile != NULL) {
+				if (!readSensorData(p_replayFile, buffer)) {
+					break;
+				}
+			}
+			else {
+				generateSensorData(sample, buffer);
+			}
+
+			// Same path as the OperationManager
+			sensorSnapshotPublish(buffer, SENSOR_SNAPSHOT_BUFFER_LENGTH_B);
+			nextSampleUs += (int64_t)samplePeriodMs * 1000;
+			sample++;
+		}
+
+		// Same path as the LVGL task
+		SensorSnapshot_t snapshot;
+		const bool newData = sensorSnapshotConsume(&snapshot);
+		guiHandleNewSensorData(screen, newData ? &snapshot : NULL, &g_lvglGuiSemaphore);
+
+		// Worst case of the display, e.g. right after a screen switch
+		if (fullRedraw) {
+			lv_obj_invalidate(lv_display_get_screen_active(p_display));
+		}
+
+		renderFrame(&statistics);
+
+		printf("%u,%llu,%llu,%u,%u,%d,%d,%d,%d\n", frame, (unsigned long long)statistics.renderUs,
+			   (unsigned long long)statistics.flushUs, statistics.flushCalls, statistics.pixelsFlushed,
+			   (int)statistics.dirtyArea.x1, (int)statistics.dirtyArea.y1, (int)statistics.dirtyArea.x2,
+			   (int)statistics.dirtyArea.y2);
+
+		totalRenderUs += statistics.renderUs;
+		totalPixelsFlushed += statistics.pixelsFlushed;
+		if (statistics.renderUs < minRenderUs) {
+			minRenderUs = statistics.renderUs;
+		}
+		if (statistics.renderUs > maxRenderUs) {
+			maxRenderUs = statistics.renderUs;
+		}
+
+		frame++;
+	}
+
+	// Print the summary
+	if (frame > 0) {
+		fprintf(stderr,
+				"%u frames with %d draw units: render avg %llu us, min %llu us, max %llu us, avg %llu pixels flushed\n",
+				frame, LV_DRAW_SW_DRAW_UNIT_CNT, (unsigned long long)(totalRenderUs / frame),
+				(unsigned long long)minRenderUs, (unsigned long long)maxRenderUs,
+				(unsigned long long)(totalPixelsFlushed / frame));
+	}
+
+	// Write the final frame for a visual check
+	if (p_dumpPath != NULL) {
+		FILE* p_dumpFile = fopen(p_dumpPath, "wb");
+		if (p_dumpFile != NULL) {
+			fwrite(g_framebuffer, sizeof(g_framebuffer), 1, p_dumpFile);
+			fclose(p_dumpFile);
+		}
+	}
+
+	if (p_replayFile != NULL) {
+		fclose(p_replayFile);
+	}
+
+	return 0;
+}
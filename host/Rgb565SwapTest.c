@@ -0,0 +1,136 @@
+// Project includes
+#include "Rgb565Swap.h"
+
+// C includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ *	Private defines
+ */
+#define LCD_RESOLUTION 240
+#define FRAME_PX (LCD_RESOLUTION * LCD_RESOLUTION)
+
+//! \brief Longest run the equality check swaps, several blocks of the kernel
+#define CHECK_MAX_PX 300
+
+//! \brief Every start within a 16 byte vector
+#define CHECK_STARTS 8
+
+#define DEFAULT_ITERATIONS 2000
+
+/*
+ *	Private typedefs
+ */
+typedef void (*SwapFunction_t)(uint16_t* p_pixels, uint32_t pixelAmount);
+
+/*
+ *	Prototypes
+ */
+//! \brief Returns a monotonic timestamp in ns
+//! \retval The timestamp in ns
+static uint64_t getTimeNs();
+
+//! \brief Compares a swap function against the reference on every start within a vector and every length up to
+//! CHECK_MAX_PX
+//! \param p_name Name of the function for the report
+//! \param swap The function
+//! \retval Bool indicating if it swapped everything like the reference
+static bool checkEquality(const char* p_name, SwapFunction_t swap);
+
+//! \brief Measures how long a swap function takes for a frame
+//! \param swap The function
+//! \param iterations How often the frame is swapped
+//! \retval Average time per frame in ns
+static uint64_t measureFrameNs(SwapFunction_t swap, uint32_t iterations);
+
+/*
+ *	Private variables
+ */
+static uint16_t g_expected[CHECK_MAX_PX + CHECK_STARTS] __attribute__((aligned(16)));
+static uint16_t g_actual[CHECK_MAX_PX + CHECK_STARTS] __attribute__((aligned(16)));
+static uint16_t g_frame[FRAME_PX] __attribute__((aligned(16)));
+
+/*
+ *	Public variables
+ */
+//! \brief Simulated time read by the esp_timer shim, unused here
+int64_t g_hostTimeUs = 0;
+
+/*
+ *	Private function implementations
+ */
+static uint64_t getTimeNs()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+static bool checkEquality(const char* p_name, const SwapFunction_t swap)
+{
+	for (uint32_t startPx = 0; startPx < CHECK_STARTS; startPx++) {
+		for (uint32_t lengthPx = 0; lengthPx <= CHECK_MAX_PX; lengthPx++) {
+			for (uint32_t i = 0; i < CHECK_MAX_PX + CHECK_STARTS; i++) {
+				g_expected[i] = (uint16_t)(i * 0x9E37 + lengthPx * 0x0101 + 0x1234);
+			}
+			memcpy(g_actual, g_expected, sizeof(g_actual));
+
+			rgb565SwapReference(&g_expected[startPx], lengthPx);
+			swap(&g_actual[startPx], lengthPx);
+			if (memcmp(g_expected, g_actual, sizeof(g_actual)) != 0) {
+				printf("%s: differs from the reference at start %u, length %u\n", p_name, (unsigned)startPx,
+					   (unsigned)lengthPx);
+				return false;
+			}
+		}
+	}
+
+	printf("%s: equal to the reference\n", p_name);
+	return true;
+}
+
+static uint64_t measureFrameNs(const SwapFunction_t swap, const uint32_t iterations)
+{
+	const uint64_t startNs = getTimeNs();
+	for (uint32_t i = 0; i < iterations; i++) {
+		swap(g_frame, FRAME_PX);
+	}
+
+	return (getTimeNs() - startNs) / iterations;
+}
+
+/*
+ *	Main
+ */
+int main(int argc, char** argv)
+{
+	const uint32_t iterations = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 0) : DEFAULT_ITERATIONS;
+	if (iterations == 0) {
+		printf("Usage: %s [iterations]\n", argv[0]);
+		return 1;
+	}
+
+	// Picks the PIE kernel on the ESP32-S3 only, the host checks the head, block and tail handling around it
+	rgb565SwapInit();
+
+	const bool equal = checkEquality("rgb565Swap", rgb565Swap) && checkEquality("rgb565SwapWords", rgb565SwapWords);
+	if (!equal) {
+		return 1;
+	}
+
+	// Swapping twice restores the frame, so every iteration works on the same data
+	for (uint32_t i = 0; i < FRAME_PX; i++) {
+		g_frame[i] = (uint16_t)(i * 0x9E37);
+	}
+
+	printf("Swapping a %dx%d frame, average of %u iterations\n", LCD_RESOLUTION, LCD_RESOLUTION, (unsigned)iterations);
+	printf("  reference:       %8.1f us\n", measureFrameNs(rgb565SwapReference, iterations) / 1000.0);
+	printf("  rgb565SwapWords: %8.1f us\n", measureFrameNs(rgb565SwapWords, iterations) / 1000.0);
+	printf("  rgb565Swap:      %8.1f us\n", measureFrameNs(rgb565Swap, iterations) / 1000.0);
+
+	return 0;
+}
@@ -0,0 +1,69 @@
+// LVGL configuration of the host build. Keep this in sync with the CONFIG_LV_* values in sdkconfig, otherwise the
+// benchmark doesn't render the same way the display board does. Everything not listed uses the LVGL defaults
+#if 1
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/*
+ *  Color settings
+ */
+#define LV_COLOR_DEPTH 16
+
+/*
+ *  Memory settings
+ */
+// The allocator of the firmware (LvglHeap.c), the same internal region overflowing into the host heap
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM
+#define LV_USE_STDLIB_STRING LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_SPRINTF LV_STDLIB_BUILTIN
+
+/*
+ *  HAL settings
+ */
+#define LV_DEF_REFR_PERIOD 16
+#define LV_DPI_DEF 130
+
+/*
+ *  Operating system
+ */
+// The firmware uses the FreeRTOS OS layer, its draw threads map to pthreads on the host
+#define LV_USE_OS LV_OS_PTHREAD
+
+// Set with -DGUI_DRAW_UNITS=<n> when configuring the host build, 2 matches the firmware
+#ifndef GUI_DRAW_UNITS
+#define GUI_DRAW_UNITS 2
+#endif
+
+/*
+ *  Rendering
+ */
+#define LV_DRAW_BUF_STRIDE_ALIGN 1
+#define LV_DRAW_BUF_ALIGN 4
+#define LV_DRAW_LAYER_SIMPLE_BUF_SIZE (24 * 1024)
+#define LV_USE_DRAW_SW 1
+#define LV_DRAW_THREAD_STACK_SIZE (8 * 1024)
+#define LV_DRAW_SW_DRAW_UNIT_CNT GUI_DRAW_UNITS
+#define LV_DRAW_SW_COMPLEX 1
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
+#define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+#define LV_CACHE_DEF_SIZE 0
+#define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
+#define LV_GRADIENT_MAX_STOPS 2
+
+/*
+ *  Logging and asserts
+ */
+#define LV_USE_LOG 0
+#define LV_USE_ASSERT_NULL 1
+#define LV_USE_ASSERT_MALLOC 1
+
+/*
+ *  Unused parts of the host build
+ */
+#define LV_BUILD_EXAMPLES 0
+#define LV_BUILD_DEMOS 0
+
+#endif // LV_CONF_H
+
+#endif
@@ -0,0 +1,9 @@
+#pragma once
+
+// Host shim of the can component. The GUI only needs the screen identifiers
+typedef enum {
+	SCREEN_TEMPERATURE,
+	SCREEN_SPEED,
+	SCREEN_RPM,
+	SCREEN_UNKNOWN
+} Screen_t;
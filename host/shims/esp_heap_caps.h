@@ -0,0 +1,28 @@
+#pragma once
+
+// Host shim of the ESP-IDF capability heap. The host has a single kind of memory, so the capabilities are ignored
+
+// C includes
+#include <malloc.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+static inline void* heap_caps_malloc(size_t size, unsigned int caps)
+{
+	(void)caps;
+	return malloc(size);
+}
+
+static inline void heap_caps_free(void* p_memory)
+{
+	free(p_memory);
+}
+
+static inline size_t heap_caps_get_allocated_size(void* p_memory)
+{
+	return malloc_usable_size(p_memory);
+}
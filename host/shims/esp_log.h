@@ -0,0 +1,12 @@
+#pragma once
+
+// Host shim of the ESP-IDF logging, prints to stderr so it doesn't mix with the benchmark output
+
+// C includes
+#include <stdio.h>
+
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) fprintf(stderr, "I (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ((void)0)
+#define ESP_LOGV(tag, format, ...) ((void)0)
@@ -0,0 +1,15 @@
+#pragma once
+
+// Host shim of the ESP-IDF timer. The benchmark advances the time itself, so the rate limits of the bindings behave
+// like on the display no matter how fast the host renders
+
+// C includes
+#include <stdint.h>
+
+//! \brief Simulated time since boot in us, owned by the benchmark
+extern int64_t g_hostTimeUs;
+
+static inline int64_t esp_timer_get_time()
+{
+	return g_hostTimeUs;
+}
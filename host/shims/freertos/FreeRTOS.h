@@ -0,0 +1,58 @@
+#pragma once
+
+// Host shim of FreeRTOS. Only the benchmark thread takes the semaphores guarding LVGL, so they never block
+
+// C includes
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/*
+ *  Types
+ */
+typedef int32_t BaseType_t;
+typedef uint32_t TickType_t;
+
+typedef struct {
+	uint32_t takeCount;
+} HostSemaphore_t;
+
+typedef HostSemaphore_t* SemaphoreHandle_t;
+
+typedef struct {
+	pthread_mutex_t mutex;
+} portMUX_TYPE;
+
+/*
+ *  Defines
+ */
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portMUX_INITIALIZER_UNLOCKED {PTHREAD_MUTEX_INITIALIZER}
+
+// The LVGL draw threads allocate from the LVGL heap too, so the critical sections have to exclude them. None of the
+// code built for the host nests them
+#define taskENTER_CRITICAL(mux) pthread_mutex_lock(&(mux)->mutex)
+#define taskEXIT_CRITICAL(mux) pthread_mutex_unlock(&(mux)->mutex)
+
+/*
+ *  Semaphore functions
+ */
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait)
+{
+	(void)ticksToWait;
+	if (semaphore != NULL) {
+		semaphore->takeCount++;
+	}
+
+	return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+	(void)semaphore;
+	return pdTRUE;
+}
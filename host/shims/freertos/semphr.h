@@ -0,0 +1,4 @@
+#pragma once
+
+// Host shim, the semaphore functions live in FreeRTOS.h
+#include "freertos/FreeRTOS.h"
@@ -0,0 +1,255 @@
+#include "multi_heap.h"
+
+// C includes
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ *  Defines
+ */
+#define BLOCK_ALIGN_B 8
+
+/*
+ *  Types
+ */
+//! \brief Header in front of every block, the blocks follow each other without gaps
+typedef struct {
+	uint32_t sizeB;
+	uint32_t isFree;
+} BlockHeader_t;
+
+struct HostMultiHeap_t {
+	portMUX_TYPE* p_lock;
+	uint8_t* p_blocks;
+	size_t blocksSizeB;
+	size_t freeB;
+	size_t minimumFreeB;
+};
+
+/*
+ *  Private functions
+ */
+static size_t alignUp(const size_t size)
+{
+	return (size + BLOCK_ALIGN_B - 1) & ~(size_t)(BLOCK_ALIGN_B - 1);
+}
+
+static BlockHeader_t* getNext(const multi_heap_handle_t heap, BlockHeader_t* p_block)
+{
+	uint8_t* p_next = (uint8_t*)p_block + sizeof(BlockHeader_t) + p_block->sizeB;
+	return p_next < heap->p_blocks + heap->blocksSizeB ? (BlockHeader_t*)p_next : NULL;
+}
+
+static void lock(const multi_heap_handle_t heap)
+{
+	if (heap->p_lock != NULL) {
+		taskENTER_CRITICAL(heap->p_lock);
+	}
+}
+
+static void unlock(const multi_heap_handle_t heap)
+{
+	if (heap->p_lock != NULL) {
+		taskEXIT_CRITICAL(heap->p_lock);
+	}
+}
+
+//! \brief Merges every free block with the free blocks following it
+static void coalesce(const multi_heap_handle_t heap)
+{
+	for (BlockHeader_t* p_block = (BlockHeader_t*)heap->p_blocks; p_block != NULL; p_block = getNext(heap, p_block)) {
+		BlockHeader_t* p_next = getNext(heap, p_block);
+		while (p_block->isFree && p_next != NULL && p_next->isFree) {
+			p_block->sizeB += sizeof(BlockHeader_t) + p_next->sizeB;
+			heap->freeB += sizeof(BlockHeader_t);
+			p_next = getNext(heap, p_block);
+		}
+	}
+}
+
+//! \brief Splits the rest of a block off into a free block if it is big enough for one
+//! \return Size of the new free block, 0 if the block was not split
+static size_t split(BlockHeader_t* p_block, const size_t sizeB)
+{
+	if (p_block->sizeB < sizeB + sizeof(BlockHeader_t) + BLOCK_ALIGN_B) {
+		return 0;
+	}
+
+	BlockHeader_t* p_rest = (BlockHeader_t*)((uint8_t*)p_block + sizeof(BlockHeader_t) + sizeB);
+	p_rest->sizeB = p_block->sizeB - sizeB - sizeof(BlockHeader_t);
+	p_rest->isFree = 1;
+	p_block->sizeB = sizeB;
+
+	return p_rest->sizeB;
+}
+
+static void* allocate(const multi_heap_handle_t heap, const size_t size)
+{
+	const size_t sizeB = alignUp(size == 0 ? 1 : size);
+	for (BlockHeader_t* p_block = (BlockHeader_t*)heap->p_blocks; p_block != NULL; p_block = getNext(heap, p_block)) {
+		if (!p_block->isFree || p_block->sizeB < sizeB) {
+			continue;
+		}
+
+		heap->freeB -= p_block->sizeB;
+		heap->freeB += split(p_block, sizeB);
+		p_block->isFree = 0;
+		if (heap->freeB < heap->minimumFreeB) {
+			heap->minimumFreeB = heap->freeB;
+		}
+
+		return (uint8_t*)p_block + sizeof(BlockHeader_t);
+	}
+
+	return NULL;
+}
+
+static void release(const multi_heap_handle_t heap, void* p_memory)
+{
+	BlockHeader_t* p_block = (BlockHeader_t*)((uint8_t*)p_memory - sizeof(BlockHeader_t));
+	p_block->isFree = 1;
+	heap->freeB += p_block->sizeB;
+	coalesce(heap);
+}
+
+/*
+ *  Functions
+ */
+multi_heap_handle_t multi_heap_register(void* p_start, const size_t size)
+{
+	// The heap itself lives at the start of the region, like the one of ESP-IDF
+	const size_t headerB = alignUp(sizeof(struct HostMultiHeap_t));
+	if (p_start == NULL || size < headerB + sizeof(BlockHeader_t) + BLOCK_ALIGN_B) {
+		return NULL;
+	}
+
+	multi_heap_handle_t heap = p_start;
+	heap->p_lock = NULL;
+	heap->p_blocks = (uint8_t*)p_start + headerB;
+	heap->blocksSizeB = (size - headerB) & ~(size_t)(BLOCK_ALIGN_B - 1);
+
+	BlockHeader_t* p_block = (BlockHeader_t*)heap->p_blocks;
+	p_block->sizeB = (uint32_t)(heap->blocksSizeB - sizeof(BlockHeader_t));
+	p_block->isFree = 1;
+	heap->freeB = p_block->sizeB;
+	heap->minimumFreeB = heap->freeB;
+
+	return heap;
+}
+
+void multi_heap_set_lock(const multi_heap_handle_t heap, void* p_lock)
+{
+	heap->p_lock = p_lock;
+}
+
+void* multi_heap_malloc(const multi_heap_handle_t heap, const size_t size)
+{
+	lock(heap);
+	void* p_memory = allocate(heap, size);
+	unlock(heap);
+
+	return p_memory;
+}
+
+void* multi_heap_realloc(const multi_heap_handle_t heap, void* p_memory, const size_t size)
+{
+	if (p_memory == NULL) {
+		return multi_heap_malloc(heap, size);
+	}
+
+	lock(heap);
+
+	// Grow in place if the block or the free block behind it is big enough
+	BlockHeader_t* p_block = (BlockHeader_t*)((uint8_t*)p_memory - sizeof(BlockHeader_t));
+	const size_t sizeB = alignUp(size == 0 ? 1 : size);
+	BlockHeader_t* p_next = getNext(heap, p_block);
+	if (p_block->sizeB < sizeB && p_next != NULL && p_next->isFree &&
+		p_block->sizeB + sizeof(BlockHeader_t) + p_next->sizeB >= sizeB) {
+		heap->freeB -= p_next->sizeB;
+		p_block->sizeB += sizeof(BlockHeader_t) + p_next->sizeB;
+	}
+
+	if (p_block->sizeB >= sizeB) {
+		heap->freeB += split(p_block, sizeB);
+		coalesce(heap);
+		if (heap->freeB < heap->minimumFreeB) {
+			heap->minimumFreeB = heap->freeB;
+		}
+		unlock(heap);
+
+		return p_memory;
+	}
+
+	// Move it, the block stays valid if that fails
+	void* p_newMemory = allocate(heap, size);
+	if (p_newMemory != NULL) {
+		memcpy(p_newMemory, p_memory, p_block->sizeB);
+		release(heap, p_memory);
+	}
+
+	unlock(heap);
+
+	return p_newMemory;
+}
+
+void multi_heap_free(const multi_heap_handle_t heap, void* p_memory)
+{
+	if (p_memory == NULL) {
+		return;
+	}
+
+	lock(heap);
+	release(heap, p_memory);
+	unlock(heap);
+}
+
+size_t multi_heap_get_allocated_size(const multi_heap_handle_t heap, void* p_memory)
+{
+	(void)heap;
+	return ((BlockHeader_t*)((uint8_t*)p_memory - sizeof(BlockHeader_t)))->sizeB;
+}
+
+void multi_heap_get_info(const multi_heap_handle_t heap, multi_heap_info_t* p_info)
+{
+	memset(p_info, 0, sizeof(multi_heap_info_t));
+
+	lock(heap);
+	for (BlockHeader_t* p_block = (BlockHeader_t*)heap->p_blocks; p_block != NULL; p_block = getNext(heap, p_block)) {
+		p_info->total_blocks++;
+		if (p_block->isFree) {
+			p_info->free_blocks++;
+			p_info->total_free_bytes += p_block->sizeB;
+			if (p_block->sizeB > p_info->largest_free_block) {
+				p_info->largest_free_block = p_block->sizeB;
+			}
+		}
+		else {
+			p_info->allocated_blocks++;
+			p_info->total_allocated_bytes += p_block->sizeB;
+		}
+	}
+	p_info->minimum_free_bytes = heap->minimumFreeB;
+	unlock(heap);
+}
+
+bool multi_heap_check(const multi_heap_handle_t heap, const bool printErrors)
+{
+	size_t walkedB = 0;
+	size_t freeB = 0;
+
+	lock(heap);
+	for (BlockHeader_t* p_block = (BlockHeader_t*)heap->p_blocks; p_block != NULL; p_block = getNext(heap, p_block)) {
+		walkedB += sizeof(BlockHeader_t) + p_block->sizeB;
+		freeB += p_block->isFree ? p_block->sizeB : 0;
+	}
+	const bool valid = walkedB == heap->blocksSizeB && freeB == heap->freeB;
+	unlock(heap);
+
+	if (!valid && printErrors) {
+		fprintf(stderr, "multi_heap: corrupted, walked %zu of %zu bytes, %zu of %zu free\n", walkedB,
+				heap->blocksSizeB, freeB, heap->freeB);
+	}
+
+	return valid;
+}
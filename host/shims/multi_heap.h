@@ -0,0 +1,39 @@
+#pragma once
+
+// Host shim of the ESP-IDF multi heap. A first fit heap inside the given region with the functions LvglHeap.c uses,
+// so the host runs out of the internal region at about the same point the display does. The bookkeeping differs from
+// the TLSF heap of ESP-IDF by a few bytes per block
+
+// C includes
+#include <stdbool.h>
+#include <stddef.h>
+
+// FreeRTOS include
+#include "freertos/FreeRTOS.h"
+
+/*
+ *  Types
+ */
+typedef struct HostMultiHeap_t* multi_heap_handle_t;
+
+typedef struct {
+	size_t total_free_bytes;
+	size_t total_allocated_bytes;
+	size_t largest_free_block;
+	size_t minimum_free_bytes;
+	size_t allocated_blocks;
+	size_t free_blocks;
+	size_t total_blocks;
+} multi_heap_info_t;
+
+/*
+ *  Functions
+ */
+multi_heap_handle_t multi_heap_register(void* p_start, size_t size);
+void multi_heap_set_lock(multi_heap_handle_t heap, void* p_lock);
+void* multi_heap_malloc(multi_heap_handle_t heap, size_t size);
+void* multi_heap_realloc(multi_heap_handle_t heap, void* p_memory, size_t size);
+void multi_heap_free(multi_heap_handle_t heap, void* p_memory);
+size_t multi_heap_get_allocated_size(multi_heap_handle_t heap, void* p_memory);
+void multi_heap_get_info(multi_heap_handle_t heap, multi_heap_info_t* p_info);
+bool multi_heap_check(multi_heap_handle_t heap, bool printErrors);
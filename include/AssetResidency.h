@@ -0,0 +1,76 @@
+#pragma once
+
+// Project includes
+#include "can.h"
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// LVGL include
+#include "lvgl.h"
+
+/*
+ *	Public defines
+ */
+//! \brief Internal RAM the assets of the shown screen may occupy. The VCR font and the rpm indicator take about 2.8 KiB
+#define ASSET_RESIDENCY_DEFAULT_BUDGET_B (4 * 1024)
+
+/*
+ *	Public typedefs
+ */
+//! \brief Usage of the internal RAM copies of the assets
+typedef struct
+{
+	//! \brief Internal RAM the assets may occupy in bytes, 0 keeps all of them in flash
+	uint32_t budgetB;
+
+	//! \brief Bytes currently occupied by copies
+	uint32_t residentB;
+
+	//! \brief Amount of assets currently copied
+	uint8_t residentAssets;
+
+	//! \brief Amount of copies created and freed since boot
+	uint32_t loads;
+	uint32_t evictions;
+
+	//! \brief Amount of assets which stayed in flash because the budget or the internal RAM was exhausted
+	uint32_t skippedLoads;
+} AssetResidencyStatistics_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Shows an image asset in an image object. The object follows the asset between flash and internal RAM until
+//! it is deleted. Has to be called with the LVGL semaphore taken
+//! \param p_image The image object
+//! \param p_source The image in flash
+//! \retval Bool indicating if the image is managed, otherwise it always stays in flash
+bool assetResidencyBindImage(lv_obj_t* p_image, const lv_image_dsc_t* p_source);
+
+//! \brief Sets a font asset as text font of a style. The style follows the asset between flash and internal RAM until
+//! it is unbound. Has to be called with the LVGL semaphore taken
+//! \param p_style The style
+//! \param p_font The font in flash
+//! \retval Bool indicating if the font is managed, otherwise it always stays in flash
+bool assetResidencyBindFont(lv_style_t* p_style, const lv_font_t* p_font);
+
+//! \brief Stops a style from following its font, has to be called before the style is reset. Has to be called with
+//! the LVGL semaphore taken
+//! \param p_style The style
+void assetResidencyUnbindFont(lv_style_t* p_style);
+
+//! \brief Evicts the assets the screen doesn't use and copies the ones it uses into internal RAM, as far as the budget
+//! allows. Has to be called with the LVGL semaphore taken
+//! \param screen The screen which is about to be shown
+void assetResidencyLoadScreen(Screen_t screen);
+
+//! \brief Changes the budget and reloads the assets of the current screen. Has to be called with the LVGL semaphore
+//! taken
+//! \param budgetB Internal RAM the assets may occupy in bytes, 0 keeps all of them in flash
+void assetResidencySetBudget(uint32_t budgetB);
+
+//! \brief Copies the usage of the internal RAM copies. Can be called from every task
+//! \param p_statistics Where the usage is copied to
+void assetResidencyGetStatistics(AssetResidencyStatistics_t* p_statistics);
@@ -0,0 +1,44 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// Project includes
+#include "EventBus.h"
+
+/*
+ *	Public defines
+ */
+//! \brief Maximum amount of channels which can subscribe to CAN messages
+#define CAN_DISPATCHER_MAX_SUBSCRIBERS 8
+
+//! \brief Sender id of the master (Sensor Board)
+#define CAN_SENDER_MASTER 0x000000
+
+//! \brief Sender filter which accepts messages of every sender
+#define CAN_SENDER_ANY 0xFFFFFFFF
+
+/*
+ *	Public functions
+ */
+//! \brief Registers the dispatcher at the CAN driver and starts its task
+//! \retval Bool indicating if the initialization was successful
+bool canDispatcherInit();
+
+//! \brief Subscribes a channel to a set of messages of one sender. Pass it with EVENT_BUS_CHANNEL_OF(name,
+//! CanMessage_t), so only channels carrying CanMessage_t compile
+//! \param channel The channel the messages are published to
+//! \param p_messageIds Array of the message ids to subscribe to
+//! \param amount Amount of message ids in the array
+//! \param senderId Only messages of this sender are delivered, CAN_SENDER_ANY to accept every sender
+//! \retval Bool indicating if the subscription was successful
+bool canDispatcherSubscribe(EventChannel_t channel, const uint8_t* p_messageIds, uint8_t amount, uint32_t senderId);
+
+//! \brief Removes all subscriptions of a channel
+//! \param channel The channel to unsubscribe
+void canDispatcherUnsubscribe(EventChannel_t channel);
+
+//! \brief Returns how many messages could not be delivered because a subscribed channel was full
+//! \retval The amount of dropped messages
+uint32_t canDispatcherGetDroppedCount();
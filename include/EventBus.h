@@ -0,0 +1,153 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// Project includes
+#include "can.h"
+
+// FreeRTOS includes
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+/*
+ *	Public defines
+ */
+//! \brief All channels of the bus with their payload type and depth. The storage of every channel is reserved at
+//! compile time, so adding one here is all it takes. The order numbers the channels in the diagnostics
+#define EVENT_BUS_CHANNELS(CHANNEL)                                                                                    \
+	/* Every received CAN frame, the CAN driver copies them into it and the dispatcher consumes them */                \
+	CHANNEL(CAN_RX, TwaiFrame_t, 32)                                                                                   \
+	CHANNEL(REGISTRATION, CanMessage_t, 10)                                                                            \
+	CHANNEL(OPERATION, CanMessage_t, 10)                                                                               \
+	/* Has to hold a whole window of update blocks */                                                                  \
+	CHANNEL(CAN_UPDATE, CanMessage_t, 32)                                                                              \
+	/* Sensor data bypasses it through the sensor snapshot */                                                          \
+	CHANNEL(GUI, GuiEvent_t, 5)                                                                                        \
+	CHANNEL(MAIN, CanMessage_t, 5)
+
+//! \brief Publishes an event, doesn't compile if p_event doesn't point to the payload type of the channel
+//! \param channel Name of the channel without the EVENT_CHANNEL_ prefix
+//! \param p_event The event, it is copied into the channel
+//! \param timeout Ticks to wait for space if the channel is full
+//! \retval Bool indicating if the event was published, it is counted as overflow otherwise
+#define EVENT_BUS_PUBLISH(channel, p_event, timeout)                                                                   \
+	eventBusPublishUnchecked(EVENT_CHANNEL_##channel,                                                                  \
+							 _Generic((p_event),                                                                       \
+								EventBusPayload_##channel##_t *: (p_event),                                            \
+								const EventBusPayload_##channel##_t *: (p_event)),                                     \
+							 (timeout))
+
+//! \brief Receives the oldest event, doesn't compile if p_event doesn't point to the payload type of the channel
+//! \param channel Name of the channel without the EVENT_CHANNEL_ prefix
+//! \param p_event Where the event is written to
+//! \param timeout Ticks to wait for an event
+//! \retval Bool indicating if an event was received
+#define EVENT_BUS_RECEIVE(channel, p_event, timeout)                                                                   \
+	eventBusReceiveUnchecked(EVENT_CHANNEL_##channel,                                                                  \
+							 _Generic((p_event), EventBusPayload_##channel##_t *: (p_event)),                          \
+							 (timeout))
+
+//! \brief Evaluates to the EventChannel_t of a channel, doesn't compile if the channel doesn't carry the given type.
+//! For code which forwards events of a known type to channels chosen by its caller
+#define EVENT_BUS_CHANNEL_OF(channel, type)                                                                            \
+	_Generic((EventBusPayload_##channel##_t*)NULL, type *: EVENT_CHANNEL_##channel)
+
+/*
+ *	Public typedefs
+ */
+//! \brief A received CAN frame which was already decoded by the dispatcher
+typedef struct
+{
+	//! \brief The message id (upper bits of the CAN id)
+	uint8_t messageId;
+
+	//! \brief The id of the sender (lower 21 bits of the CAN id)
+	uint32_t senderId;
+
+	//! \brief The dlc of the frame
+	uint8_t dlc;
+
+	//! \brief The payload of the frame
+	uint8_t buffer[8];
+} CanMessage_t;
+
+//! \brief Commands of the GUI channel
+typedef enum
+{
+	DISPLAY_TEMPERATURE_SCREEN,
+	DISPLAY_SPEED_SCREEN,
+	DISPLAY_RPM_SCREEN
+} GuiCommand_t;
+
+//! \brief An event of the GUI channel
+typedef struct
+{
+	//! \brief The command of the event
+	GuiCommand_t command;
+} GuiEvent_t;
+
+#define EVENT_BUS_ENUM(name, type, depth) EVENT_CHANNEL_##name,
+//! \brief All channels of the bus
+typedef enum
+{
+	EVENT_BUS_CHANNELS(EVENT_BUS_ENUM) EVENT_CHANNEL_AMOUNT
+} EventChannel_t;
+#undef EVENT_BUS_ENUM
+
+// The payload type of every channel, EventBusPayload_<name>_t, checked by the publish and receive macros
+#define EVENT_BUS_PAYLOAD(name, type, depth) typedef type EventBusPayload_##name##_t;
+EVENT_BUS_CHANNELS(EVENT_BUS_PAYLOAD)
+#undef EVENT_BUS_PAYLOAD
+
+//! \brief Counters of a channel
+typedef struct
+{
+	//! \brief Amount of events the channel can hold
+	uint16_t depth;
+
+	//! \brief Most events which ever waited in the channel at once. Sampled on publish, on receive and when the
+	//! counters are read, a consumer only removes events when it receives, so no backlog is missed
+	uint16_t highWater;
+
+	//! \brief Events published through the bus. The CAN driver fills CAN_RX directly, they aren't counted
+	uint32_t published;
+
+	//! \brief Events which couldn't be published because the channel stayed full. The CAN driver drops received frames
+	//! when CAN_RX is full without reporting them, they aren't counted. A high-water mark of CAN_RX at its depth is the
+	//! only sign of them
+	uint32_t overflows;
+} EventBusStatistics_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Creates the queues of all channels in their static storage
+//! \retval Bool indicating if the initialization was successful
+bool eventBusInit();
+
+//! \brief Publishes an event without checking its type, use EVENT_BUS_PUBLISH() instead
+//! \param channel The channel
+//! \param p_event The event, has to point to the payload type of the channel
+//! \param timeout Ticks to wait for space if the channel is full
+//! \retval Bool indicating if the event was published
+bool eventBusPublishUnchecked(EventChannel_t channel, const void* p_event, TickType_t timeout);
+
+//! \brief Receives an event without checking its type, use EVENT_BUS_RECEIVE() instead
+//! \param channel The channel
+//! \param p_event Where the event is written to, has to point to the payload type of the channel
+//! \param timeout Ticks to wait for an event
+//! \retval Bool indicating if an event was received
+bool eventBusReceiveUnchecked(EventChannel_t channel, void* p_event, TickType_t timeout);
+
+//! \brief Returns the queue of a channel for producers outside of the bus, like the CAN driver. Their events and the
+//! events they drop aren't counted, the high-water mark still covers them
+//! \param channel The channel
+//! \retval Pointer to the queue handle, it stays valid forever
+QueueHandle_t* eventBusGetQueue(EventChannel_t channel);
+
+//! \brief Returns the counters of a channel
+//! \param channel The channel
+//! \param p_statistics Where the counters are written to
+void eventBusGetStatistics(EventChannel_t channel, EventBusStatistics_t* p_statistics);
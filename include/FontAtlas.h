@@ -0,0 +1,48 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// LVGL include
+#include "lvgl.h"
+
+/*
+ *	Public typedefs
+ */
+//! \brief Glyph id of a character which isn't a digit
+typedef struct
+{
+	uint32_t codePoint;
+	uint16_t glyphId;
+} FontAtlasGlyph_t;
+
+//! \brief A font generated by tools/GenerateFonts.py. The bitmaps are rendered by LVGL, only the lookup is replaced
+typedef struct
+{
+	//! \brief Bitmaps and glyph descriptions. Has to be the first member, lv_font_get_bitmap_fmt_txt() casts to it
+	lv_font_fmt_txt_dsc_t base;
+
+	//! \brief Amount of glyph descriptions including the reserved id 0 and size of the bitmaps in bytes
+	uint16_t glyphAmount;
+	uint32_t bitmapSizeB;
+
+	//! \brief Glyph id of '0', the other digits follow it. 0 if the font doesn't have all digits
+	uint16_t firstDigitGlyph;
+
+	//! \brief All other glyphs, sorted by code point
+	const FontAtlasGlyph_t* p_otherGlyphs;
+	uint16_t otherGlyphAmount;
+} FontAtlas_t;
+
+/*
+ *	Public functions
+ */
+//! \brief The get_glyph_dsc callback of the generated fonts. Digits are indexed directly, everything else is found by
+//! a binary search
+//! \param p_font The font, its dsc has to be a FontAtlas_t
+//! \param p_glyph Where the description of the glyph is written to
+//! \param letter The code point
+//! \param nextLetter The following code point, unused as the fonts have no kerning
+//! \retval Bool indicating if the font has the glyph
+bool fontAtlasGetGlyphDsc(const lv_font_t* p_font, lv_font_glyph_dsc_t* p_glyph, uint32_t letter, uint32_t nextLetter);
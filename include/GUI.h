@@ -5,6 +5,27 @@
 
 // C includes
 #include <stdbool.h>
+#include <stdint.h>
+
+/*
+ *  Public typedefs
+ */
+//! \brief Statistics about how well the SPI transfers overlapped with the rendering of one frame
+typedef struct
+{
+	//! \brief Time the DMA spent transferring the frame in us
+	uint32_t transferUs;
+
+	//! \brief Time the render task was blocked by the transfers in us, while queuing the windows of a flush behind the
+	//! earlier ones and while waiting for a flush to finish
+	uint32_t stallUs;
+
+	//! \brief Time the transfers ran in parallel to the rendering in us
+	uint32_t overlapUs;
+
+	//! \brief Share of the transfer time which overlapped with the rendering
+	uint8_t overlapPercent;
+} GuiFlushStatistics_t;
 
 /*
  *  Public functions
@@ -15,4 +36,16 @@ void guiActivateRefreshing();
 
 void guiDeactivateRefreshing();
 
-bool guiDisplayScreen(Screen_t screen);
\ No newline at end of file
+bool guiDisplayScreen(Screen_t screen);
+
+//! \brief Tells the GUI that a new sensor snapshot was published, so it is rendered with the next frame
+void guiNotifyNewSensorData();
+
+//! \brief Copies the flush statistics of the last refreshed frame
+//! \param p_statistics Where the statistics are copied to
+void guiGetFlushStatistics(GuiFlushStatistics_t* p_statistics);
+
+//! \brief Changes how much internal RAM the assets of the shown screen may occupy, see AssetResidency.h. Restarts the
+//! lv_timer_handler() and flush histograms
+//! \param budgetB The budget in bytes, 0 keeps all assets in flash
+void guiSetAssetResidencyBudget(uint32_t budgetB);
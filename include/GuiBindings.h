@@ -0,0 +1,71 @@
+#pragma once
+
+// Project includes
+#include "SensorSignals.h"
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// FreeRTOS include
+#include "freertos/FreeRTOS.h"
+
+/*
+ *	Public defines
+ */
+//! \brief Maximum amount of bindings of one screen
+#define GUI_BINDINGS_MAX_PER_SCREEN 8
+
+//! \brief Returned by guiBindingsApply() if no update is pending
+#define GUI_BINDINGS_NOTHING_PENDING UINT32_MAX
+
+//! \brief Time between two steps of an interpolated value, one frame at 60 fps. Keep it in sync with
+//! CONFIG_LV_DEF_REFR_PERIOD
+#define GUI_BINDINGS_ANIMATION_PERIOD_MS 16
+
+/*
+ *	Public typedefs
+ */
+//! \brief Applies a value to a widget. Called with the LVGL semaphore held
+typedef void (*GuiBindingSetter_t)(int32_t value);
+
+//! \brief Declares how a signal is shown by a widget of a screen
+typedef struct
+{
+	//! \brief The signal which is shown
+	SensorSignal_t signal;
+
+	//! \brief Applies the value to the widget
+	GuiBindingSetter_t setter;
+
+	//! \brief Minimum time between two updates of the widget in ms. The latest value is applied once it elapsed
+	uint16_t minIntervalMs;
+
+	//! \brief Minimum change to the shown value before the widget is updated
+	uint16_t threshold;
+
+	//! \brief Additional change needed when the value turns around, so it doesn't flicker between two neighbours
+	uint16_t hysteresis;
+
+	//! \brief Longest time in ms the shown value may trail the latest sample. A new sample is animated towards over
+	//! the time between two samples, but at most this long. 0 shows every sample as a step
+	uint16_t lagBudgetMs;
+} GuiBinding_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Stores the latest value of a signal. It is shown by the next guiBindingsApply() if it matters visually
+//! \param signal The signal
+//! \param value The decoded value
+//! \param receivedUs When the frame holding the value was received, in us since boot
+void guiBindingsSetSignal(SensorSignal_t signal, int32_t value, int64_t receivedUs);
+
+//! \brief Applies the signals to the widgets of the active screen. When the bindings differ from the previous call
+//! all of their signals are applied right away, since the widgets of hidden screens are not kept up to date. Only
+//! call this from the LVGL task
+//! \param p_bindings The bindings of the active screen
+//! \param amount Amount of bindings
+//! \param p_guiSemaphore The semaphore guarding LVGL, it is only taken if a widget has to be updated
+//! \retval Time in ms until a rate limited or interpolated update is due or GUI_BINDINGS_NOTHING_PENDING
+uint32_t guiBindingsApply(const GuiBinding_t* p_bindings, uint8_t amount, const SemaphoreHandle_t* p_guiSemaphore);
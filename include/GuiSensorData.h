@@ -0,0 +1,21 @@
+#pragma once
+
+// Project includes
+#include "GuiBindings.h"
+#include "SensorSnapshot.h"
+#include "can.h"
+
+// FreeRTOS include
+#include "freertos/FreeRTOS.h"
+
+/*
+ *  Public functions
+ */
+//! \brief Decodes the sensor data and updates the widgets of a screen where it matters visually. Only call this from
+//! the LVGL task
+//! \param screen The screen which is currently displayed
+//! \param p_snapshot The latest sensor data, NULL to only apply rate limited updates which became due
+//! \param p_guiSemaphore The semaphore guarding LVGL
+//! \retval Time in ms until a rate limited update is due or GUI_BINDINGS_NOTHING_PENDING
+uint32_t guiHandleNewSensorData(Screen_t screen, const SensorSnapshot_t* p_snapshot,
+								const SemaphoreHandle_t* p_guiSemaphore);
@@ -0,0 +1,105 @@
+#pragma once
+
+// Project includes
+#include "LvglHeap.h"
+
+// C includes
+#include <stdint.h>
+
+/*
+ *	Public defines
+ */
+//! \brief Amount of buckets of a duration histogram. Bucket 0 holds everything below the base duration, every following
+//! bucket doubles the upper bound and the last one holds everything above
+#define GUI_HISTOGRAM_BUCKETS 7
+
+//! \brief Base duration of the lv_timer_handler() histogram in us
+#define GUI_TIMER_HANDLER_HISTOGRAM_BASE_US 1000
+
+//! \brief Base duration of the flush histogram in us
+#define GUI_FLUSH_HISTOGRAM_BASE_US 100
+
+/*
+ *	Public typedefs
+ */
+//! \brief Distribution of a measured duration since boot
+typedef struct
+{
+	//! \brief Amount of samples per bucket
+	uint32_t buckets[GUI_HISTOGRAM_BUCKETS];
+
+	//! \brief Amount of samples
+	uint32_t samples;
+
+	//! \brief Sum of all samples in us
+	uint64_t totalUs;
+
+	//! \brief Longest sample in us
+	uint32_t maxUs;
+} GuiDurationHistogram_t;
+
+//! \brief Render statistics since boot
+typedef struct
+{
+	//! \brief Duration of lv_timer_handler()
+	GuiDurationHistogram_t timerHandler;
+
+	//! \brief Time spent in the flush callback
+	GuiDurationHistogram_t flush;
+
+	//! \brief Amount of bytes queued for the SPI bus
+	uint64_t spiBytes;
+
+	//! \brief Amount of bytes outside of the round panel which weren't sent, in total and in the last frame
+	uint64_t spiBytesSaved;
+	uint32_t lastFrameSpiBytesSaved;
+
+	//! \brief Amount of areas LVGL flushed
+	uint32_t flushedAreas;
+
+	//! \brief Amount of completely refreshed frames
+	uint32_t frames;
+
+	//! \brief Frames per second of the last second in tenths
+	uint16_t fpsTenths;
+
+	//! \brief Amount of sensor data frames which were overwritten before they were rendered
+	uint32_t droppedSensorUpdates;
+
+	//! \brief Amount of screen switches
+	uint32_t screenSwitches;
+
+	//! \brief Time from a screen switch until its first frame was refreshed in us
+	uint32_t lastScreenSwitchUs;
+	uint32_t maxScreenSwitchUs;
+
+	//! \brief Usage of the LVGL heap
+	LvglHeapStatistics_t lvglHeap;
+} GuiRenderStatistics_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Records one run of lv_timer_handler()
+//! \param durationUs How long the run took
+void guiStatisticsRecordTimerHandler(uint32_t durationUs);
+
+//! \brief Records one call of the flush callback
+//! \param durationUs How long the callback took
+//! \param bytes Amount of bytes queued for the SPI bus
+//! \param savedBytes Amount of bytes of the area which weren't sent, as they aren't visible
+void guiStatisticsRecordFlush(uint32_t durationUs, uint32_t bytes, uint32_t savedBytes);
+
+//! \brief Records a completely refreshed frame
+void guiStatisticsRecordFrame();
+
+//! \brief Records a completed screen switch
+//! \param latencyUs Time from the switch until its first frame was refreshed
+void guiStatisticsRecordScreenSwitch(uint32_t latencyUs);
+
+//! \brief Restarts the lv_timer_handler() and flush histograms, so a measurement isn't averaged with what ran before
+void guiStatisticsResetDurations();
+
+//! \brief Copies the render statistics
+//! \param p_statistics Where the statistics are copied to
+void guiStatisticsGet(GuiRenderStatistics_t* p_statistics);
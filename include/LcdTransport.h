@@ -0,0 +1,80 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// espidf includes
+#include <esp_err.h>
+#include <esp_lcd_types.h>
+
+/*
+ *	Public typedefs
+ */
+//! \brief Called from the ISR once a transfer left the SPI bus
+//! \retval Bool indicating if a higher priority task was woken
+typedef bool (*LcdTransportDoneCallback_t)();
+
+//! \brief Throughput of the SPI transport since boot
+typedef struct
+{
+	//! \brief The SPI clock in MHz
+	uint8_t clockMhz;
+
+	//! \brief Size of one DMA transaction in bytes, a flush is split into transactions of this size
+	uint32_t transactionSizeB;
+
+	//! \brief Amount of transactions which can be queued at once
+	uint8_t queueDepth;
+
+	//! \brief Most transactions a single flush was split into
+	uint8_t maxTransactionsPerFlush;
+
+	//! \brief Bytes transferred since boot
+	uint64_t bytes;
+
+	//! \brief Time a transfer was running since boot in us
+	uint64_t busyUs;
+
+	//! \brief Achieved throughput while a transfer was running in KiB/s
+	uint32_t throughputKiBps;
+
+	//! \brief Longest transfer of a single flush in us
+	uint32_t maxTransferUs;
+} LcdTransportStatistics_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Initializes the SPI bus and the panel IO of the display with the clock profile stored in NVS. NVS has to be
+//! initialized already
+//! \param maxFlushB Size of the largest flush in bytes, the transaction queue is made deep enough to hold it entirely
+//! \param callback Called from the ISR once a transfer left the SPI bus
+//! \retval Bool indicating if the transport is ready
+bool lcdTransportInit(uint32_t maxFlushB, LcdTransportDoneCallback_t callback);
+
+//! \brief Returns the panel IO the panel driver is created on
+//! \retval The panel IO or NULL if the transport isn't initialized
+esp_lcd_panel_io_handle_t lcdTransportGetPanelIo();
+
+//! \brief Queues the pixels of an area for the display. Returns once all transactions are queued, the callback tells
+//! when they left the bus. Transfers of consecutive calls leave the bus in order
+//! \param panelHandle The panel
+//! \param xStart First column
+//! \param yStart First row
+//! \param xEnd Column after the last one
+//! \param yEnd Row after the last one
+//! \param p_pixels The pixels
+//! \param sizeB Size of the pixels in bytes
+//! \retval ESP_OK if the transfer was queued, otherwise no callback follows
+esp_err_t lcdTransportDrawBitmap(esp_lcd_panel_handle_t panelHandle, int xStart, int yStart, int xEnd, int yEnd,
+								 const void* p_pixels, uint32_t sizeB);
+
+//! \brief Stores the clock profile used from the next boot on
+//! \param clockMhz The SPI clock in MHz, one of 10, 20, 40 or 80
+//! \retval Bool indicating if the clock is supported and was stored
+bool lcdTransportStoreClockProfile(uint8_t clockMhz);
+
+//! \brief Copies the throughput statistics. Can be called from every task
+//! \param p_statistics Where the statistics are copied to
+void lcdTransportGetStatistics(LcdTransportStatistics_t* p_statistics);
@@ -0,0 +1,42 @@
+#pragma once
+
+// C includes
+#include <stdint.h>
+
+/*
+ *	Public typedefs
+ */
+//! \brief Usage of the LVGL heap
+typedef struct
+{
+	//! \brief Usable size of the internal RAM region in bytes
+	uint32_t internalSizeB;
+
+	//! \brief Bytes currently allocated in the internal RAM region
+	uint32_t internalUsedB;
+
+	//! \brief Peak of the bytes allocated in the internal RAM region
+	uint32_t internalPeakB;
+
+	//! \brief Largest block which can still be allocated in the internal RAM region
+	uint32_t internalLargestFreeB;
+
+	//! \brief How fragmented the free memory of the internal RAM region is in percent
+	uint8_t fragmentationPercent;
+
+	//! \brief Bytes currently allocated in PSRAM because the internal RAM region was full
+	uint32_t overflowUsedB;
+
+	//! \brief Peak of the bytes allocated in PSRAM
+	uint32_t overflowPeakB;
+
+	//! \brief Amount of allocations which went to PSRAM since boot
+	uint32_t overflowAllocations;
+} LvglHeapStatistics_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Copies the usage of the LVGL heap. Can be called from every task
+//! \param p_statistics Where the usage is copied to
+void lvglHeapGetStatistics(LvglHeapStatistics_t* p_statistics);
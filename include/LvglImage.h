@@ -0,0 +1,17 @@
+#pragma once
+
+// LVGL include
+#include "lvgl.h"
+
+/*
+ *	Public functions
+ */
+//! \brief Creates a horizontally mirrored copy of an image, so symmetric images are only stored once in flash. The
+//! copy is in internal RAM outside of the LVGL heap. Has to be called with the LVGL semaphore held
+//! \param p_image The image, A8, RGB565, RGB565A8 or ARGB8888
+//! \retval The mirrored image which has to be freed with lvglImageDestroyMirrored(), NULL if it couldn't be created
+lv_draw_buf_t* lvglImageCreateMirrored(const lv_image_dsc_t* p_image);
+
+//! \brief Frees a mirrored copy, no image object may show it anymore
+//! \param p_mirrored The copy created by lvglImageCreateMirrored()
+void lvglImageDestroyMirrored(lv_draw_buf_t* p_mirrored);
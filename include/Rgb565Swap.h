@@ -0,0 +1,47 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ *	Public typedefs
+ */
+//! \brief Outcome of the check and the measurement of the kernels at boot
+typedef struct
+{
+	//! \brief Bool indicating if the PIE kernel of the ESP32-S3 is used, the portable one is used otherwise
+	bool vectorKernel;
+
+	//! \brief Time a 240x240 frame takes with the used kernel and with the word wise swap of LVGL 9.2 in us, 0 if not
+	//! measured
+	uint32_t kernelFrameUs;
+	uint32_t wordFrameUs;
+} Rgb565SwapStatistics_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Checks the PIE kernel against the reference on every alignment and length it handles differently and
+//! measures it against the word wise swap. The PIE kernel is only used if it swapped everything correctly
+//! \retval Bool indicating if the PIE kernel is used
+bool rgb565SwapInit();
+
+//! \brief Swaps the bytes of RGB565 pixels in place, the GC9A01 expects the high byte first
+//! \param p_pixels The pixels, 2 byte aligned
+//! \param pixelAmount Amount of pixels
+void rgb565Swap(uint16_t* p_pixels, uint32_t pixelAmount);
+
+//! \brief Swaps pixel by pixel, the reference the kernels are checked against
+//! \param p_pixels The pixels
+//! \param pixelAmount Amount of pixels
+void rgb565SwapReference(uint16_t* p_pixels, uint32_t pixelAmount);
+
+//! \brief Swaps two pixels per 32 bit word, the same way lv_draw_sw_rgb565_swap() of LVGL 9.2 does
+//! \param p_pixels The pixels, 2 byte aligned
+//! \param pixelAmount Amount of pixels
+void rgb565SwapWords(uint16_t* p_pixels, uint32_t pixelAmount);
+
+//! \brief Copies the outcome of rgb565SwapInit()
+//! \param p_statistics Where the statistics are copied to
+void rgb565SwapGetStatistics(Rgb565SwapStatistics_t* p_statistics);
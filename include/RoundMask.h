@@ -0,0 +1,57 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// LVGL include
+#include "lvgl.h"
+
+/*
+ *	Public defines
+ */
+//! \brief Largest supported panel diameter in pixels
+#define ROUND_MASK_MAX_DIAMETER 256
+
+//! \brief Most windows a flush is split into. Setting up a window waits until the previous one left the bus, so the
+//! flush blocks for every window but the last one. Three fit the circle: the two caps and the band between them
+#define ROUND_MASK_MAX_WINDOWS 3
+
+/*
+ *	Public typedefs
+ */
+//! \brief Part of a flushed area which is sent as one window
+typedef struct
+{
+	//! \brief The area of the window on the panel
+	lv_area_t area;
+
+	//! \brief Offset of its packed pixels in the flushed buffer in bytes
+	uint32_t offsetB;
+
+	//! \brief Size of its pixels in bytes
+	uint32_t sizeB;
+} RoundMaskWindow_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Builds the visible span of every row of a round panel
+//! \param diameter Diameter of the panel in pixels
+//! \retval Bool indicating if the diameter is supported
+bool roundMaskInit(uint16_t diameter);
+
+//! \brief Shrinks an area to the bounding box of its visible part, so nothing outside the circle is rendered
+//! \param p_area The area, it keeps at least one pixel
+void roundMaskClipArea(lv_area_t* p_area);
+
+//! \brief Splits a flushed area into windows covering only its visible pixels. Rows with similar spans share a window
+//! as long as the pixels it sends in vain cost less than setting up another window. The pixels of every window are
+//! packed in place, so each window is contiguous in the buffer
+//! \param p_area The flushed area
+//! \param p_pixels The pixels of the area
+//! \param bytesPerPixel Size of one pixel in bytes
+//! \param p_windows Where the windows are written to, at least ROUND_MASK_MAX_WINDOWS
+//! \retval Amount of windows, 0 if nothing of the area is visible
+uint8_t roundMaskSplit(const lv_area_t* p_area, uint8_t* p_pixels, uint8_t bytesPerPixel,
+					   RoundMaskWindow_t* p_windows);
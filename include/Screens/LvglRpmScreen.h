@@ -1,5 +1,8 @@
 #pragma once
 
+// Project includes
+#include "GuiBindings.h"
+
 // C includes
 #include <stdbool.h>
 
@@ -9,10 +12,25 @@
 /*
  *  Public functions
  */
-bool guiCreateAndShowRpmScreen(const SemaphoreHandle_t* p_guiSemaphore);
+//! \brief Builds the screen once, it stays resident afterwards
+//! \param p_guiSemaphore The semaphore guarding LVGL
+//! \retval Bool indicating if the screen exists
+bool guiCreateRpmScreen(const SemaphoreHandle_t* p_guiSemaphore);
+
+//! \brief Makes the already built screen the active one
+//! \param p_guiSemaphore The semaphore guarding LVGL
+//! \retval Bool indicating if the screen was loaded
+bool guiShowRpmScreen(const SemaphoreHandle_t* p_guiSemaphore);
 
-void guiDestroyRpmScreen();
+//! \brief Deletes the LVGL objects of the screen. It must not be the active screen
+//! \param p_guiSemaphore The semaphore guarding LVGL
+void guiDestroyRpmScreen(const SemaphoreHandle_t* p_guiSemaphore);
 
 void guiSetRpm(uint16_t rpm, const SemaphoreHandle_t* p_guiSemaphore);
 
-void guiSetLeftIndicatorActive(bool active, const SemaphoreHandle_t* p_guiSemaphore);
\ No newline at end of file
+void guiSetLeftIndicatorActive(bool active, const SemaphoreHandle_t* p_guiSemaphore);
+
+//! \brief Returns the signals the screen shows and how they are bound to its widgets
+//! \param p_amount Where the amount of bindings is written to
+//! \retval The bindings of the screen
+const GuiBinding_t* guiGetRpmScreenBindings(uint8_t* p_amount);
\ No newline at end of file
@@ -1,5 +1,8 @@
 #pragma once
 
+// Project includes
+#include "GuiBindings.h"
+
 // C includes
 #include <stdbool.h>
 
@@ -9,10 +12,25 @@
 /*
  *  Public functions
  */
-bool guiCreateAndShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore);
+//! \brief Builds the screen once, it stays resident afterwards
+//! \param p_guiSemaphore The semaphore guarding LVGL
+//! \retval Bool indicating if the screen exists
+bool guiCreateTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore);
+
+//! \brief Makes the already built screen the active one
+//! \param p_guiSemaphore The semaphore guarding LVGL
+//! \retval Bool indicating if the screen was loaded
+bool guiShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore);
 
-void guiDestroyTemperatureScreen();
+//! \brief Deletes the LVGL objects of the screen. It must not be the active screen
+//! \param p_guiSemaphore The semaphore guarding LVGL
+void guiDestroyTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore);
 
 void guiSetWaterTemp(const uint8_t temp, const SemaphoreHandle_t* p_guiSemaphore);
 
-void guiSetFuelLevel(const uint8_t levelInPercent, const SemaphoreHandle_t* p_guiSemaphore);
\ No newline at end of file
+void guiSetFuelLevel(const uint8_t levelInPercent, const SemaphoreHandle_t* p_guiSemaphore);
+
+//! \brief Returns the signals the screen shows and how they are bound to its widgets
+//! \param p_amount Where the amount of bindings is written to
+//! \retval The bindings of the screen
+const GuiBinding_t* guiGetTemperatureScreenBindings(uint8_t* p_amount);
\ No newline at end of file
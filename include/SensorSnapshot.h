@@ -0,0 +1,44 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ *	Public defines
+ */
+//! \brief Size of the sensor data payload in bytes
+#define SENSOR_SNAPSHOT_BUFFER_LENGTH_B 8
+
+/*
+ *	Public typedefs
+ */
+//! \brief A copy of the latest received sensor data
+typedef struct
+{
+	//! \brief The raw sensor data frame payload
+	uint8_t buffer[SENSOR_SNAPSHOT_BUFFER_LENGTH_B];
+
+	//! \brief The dlc of the sensor data frame
+	uint8_t dlc;
+
+	//! \brief When the sensor data frame was received in us since boot
+	int64_t receivedUs;
+} SensorSnapshot_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Overwrites the latest sensor data. If the previous data was not consumed yet it is dropped
+//! \param p_buffer The payload of the sensor data frame
+//! \param dlc The dlc of the sensor data frame
+void sensorSnapshotPublish(const uint8_t* p_buffer, uint8_t dlc);
+
+//! \brief Copies the latest sensor data, if it changed since the last call
+//! \param p_snapshot Where the sensor data is copied to
+//! \retval Bool indicating if new sensor data was copied
+bool sensorSnapshotConsume(SensorSnapshot_t* p_snapshot);
+
+//! \brief Returns how many sensor data frames were overwritten before they were consumed
+//! \retval The amount of dropped sensor data frames
+uint32_t sensorSnapshotGetDroppedCount();
@@ -0,0 +1,86 @@
+#pragma once
+
+// C includes
+#include <stdint.h>
+
+/*
+ *	Public defines
+ */
+//! \brief Maximum payload of a CAN frame in bytes
+#define SIGNAL_DECODER_FRAME_LENGTH_B 8
+
+/*
+ *	Public typedefs
+ */
+//! \brief Byte order of a signal, used as index of the assembled frame words
+typedef enum
+{
+	SIGNAL_BYTE_ORDER_BIG_ENDIAN,
+	SIGNAL_BYTE_ORDER_LITTLE_ENDIAN,
+	SIGNAL_BYTE_ORDER_AMOUNT
+} SignalByteOrder_t;
+
+//! \brief Where a signal is in the frame and how it is scaled. Generated from the signal description, the bit
+//! positions are already converted so the raw value is a shift and a mask of the frame word of its byte order
+typedef struct
+{
+	//! \brief Index of the decoded value
+	uint8_t signal;
+
+	//! \brief The SignalByteOrder_t of the signal
+	uint8_t byteOrder;
+
+	//! \brief Position of the least significant bit in the frame word
+	uint8_t shift;
+
+	//! \brief 64 - length for signed signals, 0 for unsigned ones
+	uint8_t signShift;
+
+	//! \brief Amount of payload bytes the signal needs
+	uint8_t requiredDlc;
+
+	//! \brief Fraction bits of the multiplier and the offset
+	uint8_t fractionBits;
+
+	//! \brief The scale factor in fixed point
+	int32_t multiplier;
+
+	//! \brief The offset in fixed point, including half a unit so the value is rounded
+	int64_t offset;
+
+	//! \brief Mask of the raw value after shifting
+	uint64_t mask;
+} SignalDescription_t;
+
+//! \brief Signals which are decoded together
+typedef struct
+{
+	const SignalDescription_t* p_signals;
+	uint8_t amount;
+} SignalGroup_t;
+
+//! \brief Everything needed to decode one frame
+typedef struct
+{
+	//! \brief The signals which are in every frame, including the multiplexor
+	SignalGroup_t plain;
+
+	//! \brief The multiplexor, NULL if the frame isn't multiplexed
+	const SignalDescription_t* p_multiplexor;
+
+	//! \brief The multiplexed signals, indexed by the raw value of the multiplexor
+	const SignalGroup_t* p_multiplexed;
+	uint16_t multiplexedAmount;
+} SignalDecodeTable_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Decodes all signals of a frame. Signals which don't fit into the dlc are not touched
+//! \param p_table The generated decode table of the frame
+//! \param p_buffer The payload
+//! \param dlc The dlc of the frame
+//! \param p_values Where the values are written to, indexed by the signal
+//! \retval Bit mask of the signals which were decoded
+uint32_t signalDecoderDecode(const SignalDecodeTable_t* p_table, const uint8_t* p_buffer, uint8_t dlc,
+							 int32_t* p_values);
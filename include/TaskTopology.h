@@ -0,0 +1,78 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// FreeRTOS include
+#include "freertos/FreeRTOS.h"
+
+/*
+ *	Public typedefs
+ */
+//! \brief All tasks of the firmware. The idle tasks and the draw threads aren't created by us. The idle tasks are
+//! listed for their CPU time only, the draw threads are created by LVGL and adopted with taskTopologyAdopt()
+typedef enum {
+	TASK_LVGL,
+	TASK_GUI_EVENTS,
+	TASK_CAN_DISPATCHER,
+	TASK_OPERATION_MANAGER,
+	TASK_REGISTRATION_MANAGER,
+	TASK_UPDATE_MANAGER,
+	TASK_UPDATE_FLASH_WRITER,
+	TASK_IDLE_CORE_0,
+	TASK_IDLE_CORE_1,
+	TASK_LVGL_DRAW_0,
+	TASK_LVGL_DRAW_1,
+	TASK_AMOUNT
+} TaskId_t;
+
+//! \brief Runtime statistics of a task
+typedef struct
+{
+	//! \brief Bool indicating if the task exists, everything else is 0 otherwise
+	bool running;
+
+	//! \brief CPU time since boot in us
+	uint64_t runTimeUs;
+
+	//! \brief Share of its core the task used since the previous call for it in percent
+	uint8_t cpuPercent;
+
+	//! \brief Size of the stack and the least amount of it which was ever left in bytes
+	uint32_t stackSizeB;
+	uint32_t stackHighWaterB;
+} TaskStatistics_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Creates a task with the core, priority, stack size and stack memory of its entry in the task table
+//! \param task The task
+//! \param function The task function
+//! \param p_param Parameter passed to the task function
+//! \param p_handle Where the task handle is written to, can be NULL
+//! \retval Bool indicating if the task was created
+bool taskTopologyCreate(TaskId_t task, TaskFunction_t function, void* p_param, TaskHandle_t* p_handle);
+
+//! \brief Marks the tasks which exist so far, the tasks a library creates afterwards can be adopted
+//! \retval The mark, pass it to taskTopologyAdopt()
+uint32_t taskTopologyGetCreationMark();
+
+//! \brief Adopts the tasks created since the mark in the order of their creation. They get the priority of their entry
+//! in the task table and are included in the statistics. Their creator still owns them, so they mustn't be deleted
+//! \param firstTask The entry of the first adopted task, the following ones get the next entries
+//! \param amount Amount of tasks to adopt
+//! \param mark The mark of taskTopologyGetCreationMark() taken before the tasks were created
+//! \retval Amount of adopted tasks
+uint8_t taskTopologyAdopt(TaskId_t firstTask, uint8_t amount, uint32_t mark);
+
+//! \brief Deletes a task created by taskTopologyCreate(), a task can delete itself with it
+//! \param task The task
+void taskTopologyDelete(TaskId_t task);
+
+//! \brief Collects the runtime statistics of a task. Meant for a single diagnostic caller, the CPU share is computed
+//! against the previous call
+//! \param task The task
+//! \param p_statistics Where the statistics are written to
+void taskTopologyGetStatistics(TaskId_t task, TaskStatistics_t* p_statistics);
@@ -0,0 +1,98 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// LVGL include
+#include "lvgl.h"
+
+/*
+ *	Public defines
+ */
+//! \brief Maximum amount of digits of one display
+#define LVGL_DIGIT_DISPLAY_MAX_DIGITS 5
+
+/*
+ *	Public typedefs
+ */
+//! \brief Pre-rasterized digits 0-9 of one font. They are coverage masks, the cells recolor them when drawing
+typedef struct
+{
+	//! \brief One A8 image per digit, used directly as image source. The pixels are in p_masks
+	lv_draw_buf_t digits[10];
+
+	//! \brief The pixels of all digits. Allocated outside of the LVGL heap, so they don't push LVGL objects to PSRAM
+	uint8_t* p_masks;
+
+	//! \brief Distance between two digits
+	int32_t advanceWidth;
+
+	//! \brief Horizontal offset of the images inside of a digit cell
+	int32_t offsetX;
+
+	//! \brief The source of the glyphs, used to share them between displays
+	const lv_font_t* p_font;
+} LvglDigitGlyphs_t;
+
+//! \brief A fixed width number. Every digit is its own image, so a change only invalidates the digits that changed
+typedef struct
+{
+	//! \brief Transparent container holding the digit cells
+	lv_obj_t* container;
+
+	//! \brief One image per digit, the most significant one first
+	lv_obj_t* cells[LVGL_DIGIT_DISPLAY_MAX_DIGITS];
+
+	//! \brief The digit each cell shows, -1 if it is blank
+	int8_t shownDigits[LVGL_DIGIT_DISPLAY_MAX_DIGITS];
+
+	//! \brief Amount of cells
+	uint8_t digitCount;
+
+	//! \brief Amount of digits without the blank leading ones
+	uint8_t visibleDigits;
+
+	//! \brief The shown value, -1 before the first one was set
+	int32_t value;
+
+	//! \brief Where the visible digits are centered
+	lv_align_t align;
+	int32_t offsetX;
+	int32_t offsetY;
+
+	//! \brief The glyphs the cells show
+	const LvglDigitGlyphs_t* p_glyphs;
+} LvglDigitDisplay_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Returns the pre-rasterized digits of a font. They are rendered on the first call and shared afterwards. Has
+//! to be called with the LVGL semaphore held
+//! \param p_font The font of the digits
+//! \retval The glyphs or NULL if they couldn't be rendered
+const LvglDigitGlyphs_t* lvglDigitGlyphsGet(const lv_font_t* p_font);
+
+//! \brief Creates a digit display. Has to be called with the LVGL semaphore held
+//! \param p_display The display to initialize
+//! \param p_parent The parent object
+//! \param p_glyphs The glyphs of the digits
+//! \param digitCount Amount of digits, at most LVGL_DIGIT_DISPLAY_MAX_DIGITS
+//! \param color The color of the digits
+//! \retval Bool indicating if the display was created
+bool lvglDigitDisplayCreate(LvglDigitDisplay_t* p_display, lv_obj_t* p_parent, const LvglDigitGlyphs_t* p_glyphs,
+							uint8_t digitCount, lv_color_t color);
+
+//! \brief Centers the visible digits, like lv_obj_align() would center a label
+//! \param p_display The digit display
+//! \param align The alignment
+//! \param offsetX The horizontal offset
+//! \param offsetY The vertical offset
+void lvglDigitDisplayAlign(LvglDigitDisplay_t* p_display, lv_align_t align, int32_t offsetX, int32_t offsetY);
+
+//! \brief Shows a value. Unchanged values are skipped and only the changed digit cells are invalidated. Has to be called
+//! with the LVGL semaphore held
+//! \param p_display The digit display
+//! \param value The value, clamped to the amount of digits
+void lvglDigitDisplaySetValue(LvglDigitDisplay_t* p_display, uint32_t value);
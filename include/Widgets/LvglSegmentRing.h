@@ -0,0 +1,83 @@
+#pragma once
+
+// C includes
+#include <stdbool.h>
+#include <stdint.h>
+
+// LVGL include
+#include "lvgl.h"
+
+/*
+ *	Public defines
+ */
+//! \brief Maximum amount of segments of one ring
+#define LVGL_SEGMENT_RING_MAX_SEGMENTS 12
+
+/*
+ *	Public typedefs
+ */
+//! \brief Geometry and colors of a segment ring. Angles are in degrees, 0 is at 3 o'clock and they grow clockwise like
+//! the ones of lv_arc
+typedef struct
+{
+	//! \brief Outer diameter and width of the ring in pixels
+	uint16_t diameter;
+	uint16_t width;
+
+	//! \brief Where the first segment starts
+	uint16_t startAngle;
+
+	//! \brief Angle covered by one segment and the gap to the next one
+	uint16_t segmentAngle;
+	uint16_t gapAngle;
+
+	//! \brief Amount of segments, at most LVGL_SEGMENT_RING_MAX_SEGMENTS
+	uint8_t segmentCount;
+
+	//! \brief Color of every lit segment
+	const lv_color_t* p_colors;
+
+	//! \brief Color of the segments which aren't lit
+	lv_color_t offColor;
+} LvglSegmentRingConfig_t;
+
+//! \brief A ring of segments drawn by a single object. Every segment is a pre-rendered A8 mask which is only recolored
+//! while drawing, so nothing is anti-aliased at runtime and a change only invalidates the segments that changed
+typedef struct
+{
+	//! \brief The object drawing all segments
+	lv_obj_t* obj;
+
+	//! \brief Coverage mask of every segment
+	lv_draw_buf_t* p_masks[LVGL_SEGMENT_RING_MAX_SEGMENTS];
+
+	//! \brief Bounding box of every segment relative to the object
+	lv_area_t areas[LVGL_SEGMENT_RING_MAX_SEGMENTS];
+
+	//! \brief Color of every lit segment and of the ones which aren't lit
+	lv_color_t colors[LVGL_SEGMENT_RING_MAX_SEGMENTS];
+	lv_color_t offColor;
+
+	//! \brief Amount of segments
+	uint8_t segmentCount;
+
+	//! \brief Amount of lit segments, counted from the first one
+	uint8_t litSegments;
+} LvglSegmentRing_t;
+
+/*
+ *	Public functions
+ */
+//! \brief Creates a segment ring with all segments lit and renders its masks. Has to be called with the LVGL semaphore
+//! held
+//! \param p_ring The ring to initialize
+//! \param p_parent The parent object
+//! \param p_config The geometry and colors of the ring
+//! \retval Bool indicating if the ring was created
+bool lvglSegmentRingCreate(LvglSegmentRing_t* p_ring, lv_obj_t* p_parent, const LvglSegmentRingConfig_t* p_config);
+
+//! \brief Lights the first segments. Only the segments whose state changed are invalidated. Has to be called with the
+//! LVGL semaphore held
+//! \param p_ring The segment ring
+//! \param litSegments Amount of lit segments, clamped to the amount of segments
+void lvglSegmentRingSetLit(LvglSegmentRing_t* p_ring, uint8_t litSegments);
@@ -1,517 +0,0 @@
-/*******************************************************************************
- * Size: 80 px
- * Bpp: 1
- * Opts: --bpp 1 --size 80 --no-compress --font E1234.ttf --symbols 0123456789 --range 48-57 --format lvgl -o E1234.c
- ******************************************************************************/
-
-#ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
-#define LV_LVGL_H_INCLUDE_SIMPLE
-#endif
-#endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef E1234
-#define E1234
-#endif
-
-#ifdef E1234
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-        /* U+0030 "0" */
-        0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-        0x7f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff,
-        0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-        0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x8, 0x38, 0x0, 0x0,
-        0x0, 0x1c, 0x7c, 0x0, 0x0, 0x0, 0x3e, 0x7e,
-        0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0x7e, 0x0, 0x0, 0x0, 0x7e, 0x3c, 0x0,
-        0x0, 0x0, 0x1c, 0x10, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x8, 0x3c, 0x0, 0x0,
-        0x0, 0x1c, 0x7e, 0x0, 0x0, 0x0, 0x7e, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-        0x7e, 0x7c, 0x0, 0x0, 0x0, 0x3e, 0x38, 0x0,
-        0x0, 0x0, 0x1c, 0x10, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-
-        /* U+0031 "1" */
-        0x8, 0x1c, 0x3e, 0x7e, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c, 0x8,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x8, 0x1c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0x7e, 0x3e, 0x1c, 0x8,
-
-        /* U+0032 "2" */
-        0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-        0x7f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff,
-        0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-        0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0,
-        0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0,
-        0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0, 0x0,
-        0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0, 0x0,
-        0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-        0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0,
-        0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-
-        /* U+0033 "3" */
-        0x1f, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0x7f, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xfe, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-        0x3f, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-        0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x1c,
-        0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x7f,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x7e,
-        0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x8,
-        0x1f, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0x7f, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0x0,
-        0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xfc, 0x0,
-        0x3f, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-        0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x1c,
-        0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x3e,
-        0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x8,
-        0x1f, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0x7f, 0xff, 0xfe, 0x0, 0xff, 0xff, 0xff, 0x0,
-        0xff, 0xff, 0xfe, 0x0, 0x7f, 0xff, 0xfc, 0x0,
-        0x3f, 0xff, 0xf8, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-
-        /* U+0034 "4" */
-        0x10, 0x0, 0x0, 0x0, 0x8, 0x38, 0x0, 0x0,
-        0x0, 0x1c, 0x3c, 0x0, 0x0, 0x0, 0x3e, 0x7e,
-        0x0, 0x0, 0x0, 0x7e, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0x7e, 0x0, 0x0, 0x0, 0x7e, 0x3c, 0x0,
-        0x0, 0x0, 0x3c, 0x18, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0,
-        0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0x7e, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-        0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x8,
-
-        /* U+0035 "5" */
-        0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-        0x7f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff,
-        0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-        0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0,
-        0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x7e,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-        0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0,
-        0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0x7e, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-        0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-
-        /* U+0036 "6" */
-        0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-        0x7f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff,
-        0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-        0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0,
-        0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x0, 0x7e,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0x7e, 0x0, 0x0, 0x0, 0x0, 0x3c, 0x0,
-        0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x8, 0x3c, 0x0, 0x0,
-        0x0, 0x1c, 0x7e, 0x0, 0x0, 0x0, 0x7e, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-        0x7e, 0x7c, 0x0, 0x0, 0x0, 0x3e, 0x38, 0x0,
-        0x0, 0x0, 0x1c, 0x10, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-
-        /* U+0037 "7" */
-        0x1f, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0x7f, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xfe, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x7f, 0xff, 0xfe, 0x0,
-        0x3f, 0xff, 0xfc, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-        0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x1c,
-        0x0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x7e,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x7e,
-        0x0, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x1c,
-        0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x3e,
-        0x0, 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x8,
-
-        /* U+0038 "8" */
-        0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-        0x7f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff,
-        0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-        0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x8, 0x38, 0x0, 0x0,
-        0x0, 0x1c, 0x7c, 0x0, 0x0, 0x0, 0x3e, 0x7e,
-        0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0x7e, 0x0, 0x0, 0x0, 0x7e, 0x3c, 0x0,
-        0x0, 0x0, 0x1c, 0x10, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x8, 0x3c, 0x0, 0x0,
-        0x0, 0x1c, 0x7e, 0x0, 0x0, 0x0, 0x7e, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xfe, 0x0, 0x0, 0x0,
-        0x7e, 0x7c, 0x0, 0x0, 0x0, 0x3e, 0x38, 0x0,
-        0x0, 0x0, 0x1c, 0x10, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-
-        /* U+0039 "9" */
-        0x0, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0,
-        0x7f, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xff,
-        0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-        0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xf8, 0x0,
-        0x10, 0x0, 0x0, 0x0, 0x8, 0x38, 0x0, 0x0,
-        0x0, 0x1c, 0x7c, 0x0, 0x0, 0x0, 0x3e, 0x7e,
-        0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-        0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-        0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
-        0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-        0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
-        0xff, 0x7e, 0x0, 0x0, 0x0, 0x7e, 0x3c, 0x0,
-        0x0, 0x0, 0x1c, 0x10, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0,
-        0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-        0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-        0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0,
-        0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-        0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-        0x7e, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-        0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x8,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-        0xfc, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0,
-        0xff, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xfe,
-        0x0, 0x0, 0x3f, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x0};
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-        {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-        {.bitmap_index = 0, .adv_w = 1024, .box_w = 40, .box_h = 72, .ofs_x = 12, .ofs_y = 0},
-        {.bitmap_index = 360, .adv_w = 1024, .box_w = 8, .box_h = 56, .ofs_x = 44, .ofs_y = 8},
-        {.bitmap_index = 416, .adv_w = 1024, .box_w = 40, .box_h = 72, .ofs_x = 12, .ofs_y = 0},
-        {.bitmap_index = 776, .adv_w = 1024, .box_w = 32, .box_h = 72, .ofs_x = 20, .ofs_y = 0},
-        {.bitmap_index = 1064, .adv_w = 1024, .box_w = 40, .box_h = 56, .ofs_x = 12, .ofs_y = 8},
-        {.bitmap_index = 1344, .adv_w = 1024, .box_w = 40, .box_h = 72, .ofs_x = 12, .ofs_y = 0},
-        {.bitmap_index = 1704, .adv_w = 1024, .box_w = 40, .box_h = 72, .ofs_x = 12, .ofs_y = 0},
-        {.bitmap_index = 2064, .adv_w = 1024, .box_w = 32, .box_h = 64, .ofs_x = 20, .ofs_y = 8},
-        {.bitmap_index = 2320, .adv_w = 1024, .box_w = 40, .box_h = 72, .ofs_x = 12, .ofs_y = 0},
-        {.bitmap_index = 2680, .adv_w = 1024, .box_w = 40, .box_h = 72, .ofs_x = 12, .ofs_y = 0}};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-        {
-                {.range_start = 48, .range_length = 10, .glyph_id_start = 1, .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY}};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-        .glyph_bitmap = glyph_bitmap,
-        .glyph_dsc = glyph_dsc,
-        .cmaps = cmaps,
-        .kern_dsc = NULL,
-        .kern_scale = 0,
-        .cmap_num = 1,
-        .bpp = 1,
-        .kern_classes = 0,
-        .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-        .cache = &cache
-#endif
-};
-
-extern const lv_font_t lv_font_montserrat_24;
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t E1234_FONT = {
-#else
-lv_font_t E1234_FONT = {
-#endif
-        .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt, /*Function pointer to get glyph's data*/
-        .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt, /*Function pointer to get glyph's bitmap*/
-        .line_height = 72,                              /*The maximum line height required by the font*/
-        .base_line = 0,                                 /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-        .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-        .underline_position = -8,
-        .underline_thickness = 6,
-#endif
-        .dsc = &font_dsc, /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-        .fallback = NULL,
-#endif
-        .user_data = NULL,
-};
-
-#endif /*#if E1234*/
@@ -1,431 +1,225 @@
-/*******************************************************************************
- * Size: 70 px
- * Bpp: 1
- * Opts: --bpp 1 --size 70 --no-compress --font E1234.ttf --symbols 1234567890 --format lvgl -o E1234_70.c
- ******************************************************************************/
-
-#ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
-#define LV_LVGL_H_INCLUDE_SIMPLE
-#endif
-#endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef E1234_70
-#define E1234_70
-#endif
-
-#ifdef E1234_70
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-        /* U+0030 "0" */
-        0x0, 0x3f, 0xff, 0x80, 0x0, 0xf, 0xff, 0xf8,
-        0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-        0xf8, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0xff,
-        0xff, 0x80, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x80,
-        0x0, 0x0, 0x8, 0x38, 0x0, 0x0, 0x3, 0x8f,
-        0x80, 0x0, 0x0, 0xfb, 0xf8, 0x0, 0x0, 0x3f,
-        0xff, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0,
-        0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-        0x3, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-        0x0, 0xf, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xf8,
-        0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x7, 0xff,
-        0xe0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0x80, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
-        0x7f, 0xfe, 0x0, 0x0, 0xf, 0xef, 0x80, 0x0,
-        0x0, 0xf8, 0xe0, 0x0, 0x0, 0xe, 0x8, 0x0,
-        0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x8, 0x0, 0x0, 0x0, 0x83, 0x80, 0x0,
-        0x0, 0x38, 0xf8, 0x0, 0x0, 0xf, 0xbf, 0x80,
-        0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xfe,
-        0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x1, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x7,
-        0xff, 0xe0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-        0x1f, 0xff, 0x80, 0x0, 0x3, 0xff, 0xf0, 0x0,
-        0x0, 0x7f, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xc0,
-        0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-        0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0xfe,
-        0xf8, 0x0, 0x0, 0xf, 0x8e, 0x0, 0x0, 0x0,
-        0xe0, 0x80, 0x0, 0x0, 0x8, 0x0, 0x3f, 0xff,
-        0x80, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x3, 0xff,
-        0xff, 0x80, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xf,
-        0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-        0xf, 0xff, 0xe0, 0x0,
-
-        /* U+0031 "1" */
-        0x10, 0x71, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-        0xf1, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x1, 0x7, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xdf, 0x1c, 0x10,
-
-        /* U+0032 "2" */
-        0x0, 0x3f, 0xff, 0x80, 0x0, 0xf, 0xff, 0xf8,
-        0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-        0xf8, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0xff,
-        0xff, 0x80, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x0,
-        0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x3, 0x80,
-        0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x3f,
-        0x80, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0,
-        0xfe, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0,
-        0x3, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-        0x0, 0xf, 0xe0, 0x0, 0x0, 0x1, 0xfc, 0x0,
-        0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x7, 0xf0,
-        0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x1f,
-        0xc0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-        0x7f, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-        0x0, 0xf8, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0,
-        0x0, 0x0, 0x80, 0x3, 0xff, 0xf8, 0x0, 0x0,
-        0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0xf, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xe0,
-        0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xfe,
-        0x0, 0x8, 0x0, 0x0, 0x0, 0x3, 0x80, 0x0,
-        0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x3f, 0x80,
-        0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0xfe,
-        0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x3,
-        0xf8, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-        0xf, 0xe0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
-        0x0, 0x3f, 0x80, 0x0, 0x0, 0x7, 0xf0, 0x0,
-        0x0, 0x0, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xc0,
-        0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-        0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0,
-        0xf8, 0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0x0,
-        0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-        0x80, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x3, 0xff,
-        0xff, 0x80, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xf,
-        0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-        0xf, 0xff, 0xe0, 0x0,
-
-        /* U+0033 "3" */
-        0x1f, 0xff, 0xc0, 0x3, 0xff, 0xfe, 0x0, 0x7f,
-        0xff, 0xf0, 0xf, 0xff, 0xff, 0x80, 0x7f, 0xff,
-        0xf0, 0x3, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xc0,
-        0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x1, 0xc0,
-        0x0, 0x0, 0x3e, 0x0, 0x0, 0x7, 0xf0, 0x0,
-        0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-        0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f,
-        0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0,
-        0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-        0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x7,
-        0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0,
-        0x0, 0x0, 0x3e, 0x0, 0x0, 0x1, 0xc0, 0x0,
-        0x0, 0x8, 0x1f, 0xff, 0xc0, 0x3, 0xff, 0xfe,
-        0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff, 0xff, 0x80,
-        0x7f, 0xff, 0xf0, 0x3, 0xff, 0xfe, 0x0, 0x1f,
-        0xff, 0xc0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0,
-        0x1, 0xc0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x7,
-        0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0,
-        0x0, 0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0,
-        0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-        0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f,
-        0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0,
-        0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-        0x7, 0xf0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x1,
-        0xc0, 0x0, 0x0, 0x8, 0x1f, 0xff, 0xc0, 0x3,
-        0xff, 0xfe, 0x0, 0x7f, 0xff, 0xf0, 0xf, 0xff,
-        0xff, 0x80, 0x7f, 0xff, 0xf0, 0x3, 0xff, 0xfe,
-        0x0, 0x1f, 0xff, 0xc0, 0x0,
-
-        /* U+0034 "4" */
-        0x10, 0x0, 0x0, 0x1, 0x7, 0x0, 0x0, 0x0,
-        0x71, 0xf0, 0x0, 0x0, 0x1f, 0x7f, 0x0, 0x0,
-        0x7, 0xff, 0xe0, 0x0, 0x0, 0xff, 0xfc, 0x0,
-        0x0, 0x1f, 0xff, 0x80, 0x0, 0x3, 0xff, 0xf0,
-        0x0, 0x0, 0x7f, 0xfe, 0x0, 0x0, 0xf, 0xff,
-        0xc0, 0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x3f,
-        0xff, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0,
-        0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-        0x3, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-        0x0, 0xf, 0xff, 0xc0, 0x0, 0x1, 0xfd, 0xf0,
-        0x0, 0x0, 0x1f, 0x1c, 0x0, 0x0, 0x1, 0xc1,
-        0x0, 0x0, 0x0, 0x10, 0x0, 0x7f, 0xff, 0x0,
-        0x0, 0x1f, 0xff, 0xf0, 0x0, 0x7, 0xff, 0xff,
-        0x0, 0x1, 0xff, 0xff, 0xf0, 0x0, 0x1f, 0xff,
-        0xfc, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x1f,
-        0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-        0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x1, 0xf0,
-        0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0xf,
-        0xe0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-        0x3f, 0x80, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-        0x0, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0,
-        0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0x0,
-        0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x1, 0xfc,
-        0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x7,
-        0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-        0x1f, 0xc0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0,
-        0x0, 0x1c, 0x0, 0x0, 0x0, 0x1, 0x0,
-
-        /* U+0035 "5" */
-        0x0, 0x3f, 0xff, 0x80, 0x0, 0xf, 0xff, 0xf8,
-        0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-        0xf8, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0xff,
-        0xff, 0x80, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x80,
-        0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0xf,
-        0x80, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-        0x7f, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-        0x1, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-        0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-        0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x3, 0xf8,
-        0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0xf,
-        0xe0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-        0x3f, 0x80, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-        0x0, 0xfe, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0,
-        0x0, 0x0, 0xe0, 0x0, 0x0, 0x0, 0x8, 0x0,
-        0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-        0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0xf, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xe0,
-        0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xfe,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0,
-        0x0, 0x38, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0,
-        0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0x0,
-        0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x1, 0xfc,
-        0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x7,
-        0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-        0x1f, 0xc0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-        0x0, 0x7f, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-        0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0x80,
-        0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0xfe,
-        0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-        0xe0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x3f, 0xff,
-        0x80, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x3, 0xff,
-        0xff, 0x80, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xf,
-        0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-        0xf, 0xff, 0xe0, 0x0,
-
-        /* U+0036 "6" */
-        0x0, 0x3f, 0xff, 0x80, 0x0, 0xf, 0xff, 0xf8,
-        0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-        0xf8, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0xff,
-        0xff, 0x80, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x80,
-        0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x0, 0xf,
-        0x80, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0,
-        0x7f, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0, 0x0,
-        0x1, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
-        0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-        0x0, 0x0, 0x1f, 0xc0, 0x0, 0x0, 0x3, 0xf8,
-        0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0xf,
-        0xe0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-        0x3f, 0x80, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-        0x0, 0xfe, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0,
-        0x0, 0x0, 0xe0, 0x0, 0x0, 0x0, 0x8, 0x0,
-        0x0, 0x0, 0x0, 0x3, 0xff, 0xf8, 0x0, 0x0,
-        0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0xf, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xe0,
-        0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xfe,
-        0x0, 0x8, 0x0, 0x0, 0x0, 0x83, 0x80, 0x0,
-        0x0, 0x38, 0xf8, 0x0, 0x0, 0xf, 0xbf, 0x80,
-        0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xfe,
-        0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x1, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x7,
-        0xff, 0xe0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-        0x1f, 0xff, 0x80, 0x0, 0x3, 0xff, 0xf0, 0x0,
-        0x0, 0x7f, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xc0,
-        0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-        0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0xfe,
-        0xf8, 0x0, 0x0, 0xf, 0x8e, 0x0, 0x0, 0x0,
-        0xe0, 0x80, 0x0, 0x0, 0x8, 0x0, 0x3f, 0xff,
-        0x80, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x3, 0xff,
-        0xff, 0x80, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xf,
-        0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-        0xf, 0xff, 0xe0, 0x0,
-
-        /* U+0037 "7" */
-        0x1f, 0xff, 0xc0, 0x3, 0xff, 0xfe, 0x0, 0x7f,
-        0xff, 0xf0, 0xf, 0xff, 0xff, 0x80, 0x7f, 0xff,
-        0xf0, 0x3, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xc0,
-        0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x1, 0xc0,
-        0x0, 0x0, 0x3e, 0x0, 0x0, 0x7, 0xf0, 0x0,
-        0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-        0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f,
-        0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0,
-        0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-        0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x7,
-        0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0,
-        0x0, 0x0, 0x3e, 0x0, 0x0, 0x1, 0xc0, 0x0,
-        0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0,
-        0x1, 0xc0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x7,
-        0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0,
-        0x0, 0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0,
-        0x0, 0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0,
-        0x7f, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f,
-        0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0,
-        0x0, 0x7, 0xf0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-        0x7, 0xf0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0x1,
-        0xc0, 0x0, 0x0, 0x8,
-
-        /* U+0038 "8" */
-        0x0, 0x3f, 0xff, 0x80, 0x0, 0xf, 0xff, 0xf8,
-        0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-        0xf8, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0xff,
-        0xff, 0x80, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x80,
-        0x0, 0x0, 0x8, 0x38, 0x0, 0x0, 0x3, 0x8f,
-        0x80, 0x0, 0x0, 0xfb, 0xf8, 0x0, 0x0, 0x3f,
-        0xff, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0,
-        0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-        0x3, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-        0x0, 0xf, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xf8,
-        0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x7, 0xff,
-        0xe0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0x80, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
-        0x7f, 0xfe, 0x0, 0x0, 0xf, 0xef, 0x80, 0x0,
-        0x0, 0xf8, 0xe0, 0x0, 0x0, 0xe, 0x8, 0x0,
-        0x0, 0x0, 0x80, 0x3, 0xff, 0xf8, 0x0, 0x0,
-        0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0xf, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xe0,
-        0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xfe,
-        0x0, 0x8, 0x0, 0x0, 0x0, 0x83, 0x80, 0x0,
-        0x0, 0x38, 0xf8, 0x0, 0x0, 0xf, 0xbf, 0x80,
-        0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xfe,
-        0x0, 0x0, 0xf, 0xff, 0xc0, 0x0, 0x1, 0xff,
-        0xf8, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x7,
-        0xff, 0xe0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0,
-        0x1f, 0xff, 0x80, 0x0, 0x3, 0xff, 0xf0, 0x0,
-        0x0, 0x7f, 0xfe, 0x0, 0x0, 0xf, 0xff, 0xc0,
-        0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x3f, 0xff,
-        0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0xfe,
-        0xf8, 0x0, 0x0, 0xf, 0x8e, 0x0, 0x0, 0x0,
-        0xe0, 0x80, 0x0, 0x0, 0x8, 0x0, 0x3f, 0xff,
-        0x80, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x3, 0xff,
-        0xff, 0x80, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xf,
-        0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-        0xf, 0xff, 0xe0, 0x0,
-
-        /* U+0039 "9" */
-        0x0, 0x3f, 0xff, 0x80, 0x0, 0xf, 0xff, 0xf8,
-        0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff,
-        0xf8, 0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0xff,
-        0xff, 0x80, 0x0, 0xf, 0xff, 0xe0, 0x0, 0x80,
-        0x0, 0x0, 0x8, 0x38, 0x0, 0x0, 0x3, 0x8f,
-        0x80, 0x0, 0x0, 0xfb, 0xf8, 0x0, 0x0, 0x3f,
-        0xff, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0,
-        0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-        0x3, 0xff, 0xf0, 0x0, 0x0, 0x7f, 0xfe, 0x0,
-        0x0, 0xf, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xf8,
-        0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x7, 0xff,
-        0xe0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x0, 0x1f,
-        0xff, 0x80, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
-        0x7f, 0xfe, 0x0, 0x0, 0xf, 0xef, 0x80, 0x0,
-        0x0, 0xf8, 0xe0, 0x0, 0x0, 0xe, 0x8, 0x0,
-        0x0, 0x0, 0x80, 0x3, 0xff, 0xf8, 0x0, 0x0,
-        0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xf8, 0x0,
-        0xf, 0xff, 0xff, 0x80, 0x0, 0xff, 0xff, 0xe0,
-        0x0, 0xf, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xfe,
-        0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0,
-        0x0, 0x38, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0,
-        0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0x7f, 0x0,
-        0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x1, 0xfc,
-        0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x7,
-        0xf0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0x0, 0x0,
-        0x1f, 0xc0, 0x0, 0x0, 0x3, 0xf8, 0x0, 0x0,
-        0x0, 0x7f, 0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
-        0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0x80,
-        0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0xfe,
-        0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
-        0xe0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x3f, 0xff,
-        0x80, 0x0, 0xf, 0xff, 0xf8, 0x0, 0x3, 0xff,
-        0xff, 0x80, 0x0, 0xff, 0xff, 0xf8, 0x0, 0xf,
-        0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0x80, 0x0,
-        0xf, 0xff, 0xe0, 0x0};
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-        {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-        {.bitmap_index = 0, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
-        {.bitmap_index = 276, .adv_w = 896, .box_w = 7, .box_h = 49, .ofs_x = 39, .ofs_y = 7},
-        {.bitmap_index = 319, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
-        {.bitmap_index = 595, .adv_w = 896, .box_w = 28, .box_h = 63, .ofs_x = 18, .ofs_y = 0},
-        {.bitmap_index = 816, .adv_w = 896, .box_w = 35, .box_h = 49, .ofs_x = 10, .ofs_y = 7},
-        {.bitmap_index = 1031, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
-        {.bitmap_index = 1307, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
-        {.bitmap_index = 1583, .adv_w = 896, .box_w = 28, .box_h = 56, .ofs_x = 18, .ofs_y = 7},
-        {.bitmap_index = 1779, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0},
-        {.bitmap_index = 2055, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0}};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-        {
-                {.range_start = 48, .range_length = 10, .glyph_id_start = 1, .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY}};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_glyph_cache_t cache;
-#endif
+// Generated by GenerateFonts.py from E1234.ttf at 70 px, don't edit
+#include "Fonts.h"
+
+// Project includes
+#include "FontAtlas.h"
+
+/*
+ *	Private variables
+ */
+//! \brief The bitmaps of all glyphs, 2388 B of which 57 B keep glyphs within their cache lines
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t g_atlas[] __attribute__((aligned(32))) = {
+	// U+0030 "0"
+	0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+	0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x80,
+	0x00, 0x00, 0x08, 0x38, 0x00, 0x00, 0x03, 0x8F, 0x80, 0x00, 0x00, 0xFB, 0xF8, 0x00, 0x00, 0x3F,
+	0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
+	0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8,
+	0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
+	0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00,
+	0x00, 0xF8, 0xE0, 0x00, 0x00, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x83, 0x80, 0x00,
+	0x00, 0x38, 0xF8, 0x00, 0x00, 0x0F, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE,
+	0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07,
+	0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+	0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+	0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x00,
+	0xE0, 0x80, 0x00, 0x00, 0x08, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+	0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x0F, 0xFF, 0xE0, 0x00,
+	// U+0031 "1"
+	0x10, 0x71, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+	0xF1, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x1C, 0x10, 0x00,
+	// U+0032 "2"
+	0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+	0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F,
+	0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
+	0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00,
+	0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F,
+	0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
+	0x00, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0,
+	0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
+	0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE,
+	0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
+	0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00,
+	0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F,
+	0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+	0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0033 "3"
+	0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
+	0xF0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0xC0,
+	0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+	0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00,
+	0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
+	0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xC0, 0x00,
+	0x00, 0x08, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80,
+	0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x01, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0,
+	0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+	0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00,
+	0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01,
+	0xC0, 0x00, 0x00, 0x08, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF,
+	0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	// U+0034 "4"
+	0x10, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x71, 0xF0, 0x00, 0x00, 0x1F, 0x7F, 0x00, 0x00,
+	0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0,
+	0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
+	0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
+	0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFD, 0xF0,
+	0x00, 0x00, 0x1F, 0x1C, 0x00, 0x00, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0xFF, 0x00,
+	0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
+	0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F,
+	0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00,
+	0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07,
+	0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
+	0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0035 "5"
+	0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+	0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
+	0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+	0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
+	0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
+	0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0,
+	0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00,
+	0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07,
+	0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
+	0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80,
+	0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+	0xE0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+	0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0036 "6"
+	0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+	0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
+	0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+	0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8,
+	0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,
+	0x3F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0,
+	0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x08, 0x00, 0x00, 0x00, 0x83, 0x80, 0x00,
+	0x00, 0x38, 0xF8, 0x00, 0x00, 0x0F, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE,
+	0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07,
+	0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+	0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+	0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x00,
+	0xE0, 0x80, 0x00, 0x00, 0x08, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+	0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x0F, 0xFF, 0xE0, 0x00,
+	// U+0037 "7"
+	0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
+	0xF0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0xC0,
+	0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+	0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00,
+	0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
+	0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xC0, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0x01, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0,
+	0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+	0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00,
+	0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01,
+	0xC0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0038 "8"
+	0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+	0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x80,
+	0x00, 0x00, 0x08, 0x38, 0x00, 0x00, 0x03, 0x8F, 0x80, 0x00, 0x00, 0xFB, 0xF8, 0x00, 0x00, 0x3F,
+	0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
+	0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8,
+	0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
+	0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00,
+	0x00, 0xF8, 0xE0, 0x00, 0x00, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0,
+	0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x08, 0x00, 0x00, 0x00, 0x83, 0x80, 0x00,
+	0x00, 0x38, 0xF8, 0x00, 0x00, 0x0F, 0xBF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE,
+	0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07,
+	0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+	0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
+	0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFE, 0xF8, 0x00, 0x00, 0x0F, 0x8E, 0x00, 0x00, 0x00,
+	0xE0, 0x80, 0x00, 0x00, 0x08, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+	0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0039 "9"
+	0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF,
+	0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x80,
+	0x00, 0x00, 0x08, 0x38, 0x00, 0x00, 0x03, 0x8F, 0x80, 0x00, 0x00, 0xFB, 0xF8, 0x00, 0x00, 0x3F,
+	0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
+	0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF8,
+	0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
+	0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xEF, 0x80, 0x00,
+	0x00, 0xF8, 0xE0, 0x00, 0x00, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x80, 0x03, 0xFF, 0xF8, 0x00, 0x00,
+	0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xE0,
+	0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x00,
+	0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07,
+	0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
+	0x00, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0x80,
+	0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+	0xE0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
+	0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+	0x0F, 0xFF, 0xE0, 0x00,
+};
 
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-        .glyph_bitmap = glyph_bitmap,
-        .glyph_dsc = glyph_dsc,
-        .cmaps = cmaps,
-        .kern_dsc = NULL,
-        .kern_scale = 0,
-        .cmap_num = 1,
-        .bpp = 1,
-        .kern_classes = 0,
-        .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-        .cache = &cache
-#endif
+//! \brief Glyph id 0 is reserved, the digits start at 1 if the font has all of them
+static const lv_font_fmt_txt_glyph_dsc_t g_glyphs[] = {
+	{.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+	{.bitmap_index = 0, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0}, // U+0030 "0"
+	{.bitmap_index = 276, .adv_w = 896, .box_w = 7, .box_h = 49, .ofs_x = 39, .ofs_y = 7}, // U+0031 "1"
+	{.bitmap_index = 320, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0}, // U+0032 "2"
+	{.bitmap_index = 608, .adv_w = 896, .box_w = 28, .box_h = 63, .ofs_x = 18, .ofs_y = 0}, // U+0033 "3"
+	{.bitmap_index = 832, .adv_w = 896, .box_w = 35, .box_h = 49, .ofs_x = 10, .ofs_y = 7}, // U+0034 "4"
+	{.bitmap_index = 1056, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0}, // U+0035 "5"
+	{.bitmap_index = 1344, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0}, // U+0036 "6"
+	{.bitmap_index = 1620, .adv_w = 896, .box_w = 28, .box_h = 56, .ofs_x = 18, .ofs_y = 7}, // U+0037 "7"
+	{.bitmap_index = 1824, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0}, // U+0038 "8"
+	{.bitmap_index = 2112, .adv_w = 896, .box_w = 35, .box_h = 63, .ofs_x = 10, .ofs_y = 0}, // U+0039 "9"
 };
 
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
+static const FontAtlas_t g_fontAtlas = {
+	.base =
+		{
+			.glyph_bitmap = g_atlas,
+			.glyph_dsc = g_glyphs,
+			.cmaps = NULL,
+			.kern_dsc = NULL,
+			.kern_scale = 0,
+			.cmap_num = 0,
+			.bpp = 1,
+			.kern_classes = 0,
+			.bitmap_format = 0,
+		},
+	.glyphAmount = 11,
+	.bitmapSizeB = 2388,
+	.firstDigitGlyph = 1,
+	.p_otherGlyphs = NULL,
+	.otherGlyphAmount = 0,
+};
 
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
+/*
+ *	Public variables
+ */
 const lv_font_t E1234_70_FONT = {
-#else
-lv_font_t E1234_70 = {
-#endif
-        .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt, /*Function pointer to get glyph's data*/
-        .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt, /*Function pointer to get glyph's bitmap*/
-        .line_height = 63,                              /*The maximum line height required by the font*/
-        .base_line = 0,                                 /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-        .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-        .underline_position = -7,
-        .underline_thickness = 5,
-#endif
-        .dsc = &font_dsc, /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-        .fallback = NULL,
-#endif
-        .user_data = NULL,
+	.get_glyph_dsc = fontAtlasGetGlyphDsc,
+	.get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+	.line_height = 63,
+	.base_line = 0,
+	.subpx = LV_FONT_SUBPX_NONE,
+	.underline_position = -7,
+	.underline_thickness = 5,
+	.dsc = &g_fontAtlas,
+	.fallback = NULL,
+	.user_data = NULL,
 };
-
-#endif /*#if E1234_70*/
@@ -0,0 +1,15 @@
+// Generated by GenerateFonts.py, don't edit
+#pragma once
+
+// LVGL include
+#include "lvgl.h"
+
+/*
+ *	Public variables
+ */
+//! \brief E1234.ttf at 80 px with 0123456789
+extern const lv_font_t E1234_80_FONT;
+//! \brief E1234.ttf at 70 px with 0123456789
+extern const lv_font_t E1234_70_FONT;
+//! \brief VCR_OSD_MONO_1.001.ttf at 24 px with 0123456789%CLMPRhkm°
+extern const lv_font_t VCR_OSD_MONO_24_FONT;
@@ -1,524 +1,146 @@
-/*******************************************************************************
- * Size: 24 px
- * Bpp: 1
- * Opts: --bpp 1 --size 24 --no-compress --font VCR_OSD_MONO_1.001.ttf --symbols 0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ°% --format lvgl -o VCR_OSD_MONO_24.c
- ******************************************************************************/
-
-#ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
-#define LV_LVGL_H_INCLUDE_SIMPLE
-#endif
-#endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef VCR_OSD_MONO_24
-#define VCR_OSD_MONO_24
-#endif
-
-#ifdef VCR_OSD_MONO_24
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-        /* U+0025 "%" */
-        0x78, 0x37, 0x83, 0xcc, 0x3c, 0xc3, 0xcc, 0xec,
-        0xce, 0x7c, 0xc0, 0xb0, 0x7, 0x0, 0xf0, 0x3c,
-        0xe3, 0x8e, 0x73, 0x3c, 0x33, 0xc3, 0x3c, 0x3f,
-        0xc0, 0xe0,
-
-        /* U+0030 "0" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x3, 0xc1, 0xfc, 0x7f, 0xcf, 0x3d, 0xe3, 0xfc,
-        0x3f, 0x3, 0xc0, 0x34, 0x4, 0x60, 0xc7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0031 "1" */
-        0x18, 0x31, 0xe7, 0xcf, 0x83, 0x6, 0xc, 0x18,
-        0x30, 0x60, 0xc1, 0x83, 0x6, 0x7f, 0xfe,
-
-        /* U+0032 "2" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x30,
-        0x3, 0x0, 0x30, 0xc, 0x3f, 0xc7, 0xf8, 0xe0,
-        0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xf, 0xff,
-        0xff, 0xf0,
-
-        /* U+0033 "3" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x30,
-        0x3, 0x0, 0x30, 0xc, 0xf, 0xc0, 0xfc, 0x0,
-        0xc0, 0x3, 0x0, 0x3c, 0x3, 0xe0, 0xf7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0034 "4" */
-        0x1, 0x80, 0x18, 0x3, 0x80, 0x78, 0x1f, 0x81,
-        0xd8, 0x79, 0x8f, 0x18, 0xf1, 0x8c, 0x18, 0xff,
-        0xff, 0xff, 0x1, 0x80, 0x18, 0x1, 0x80, 0x18,
-        0x1, 0x80,
-
-        /* U+0035 "5" */
-        0xff, 0xff, 0xff, 0xc0, 0xc, 0x0, 0xc0, 0xc,
-        0x0, 0xff, 0x8f, 0xfc, 0x0, 0xf0, 0x3, 0x0,
-        0x30, 0x3, 0x0, 0x3c, 0x3, 0xe0, 0xf7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0036 "6" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x0, 0xc0, 0xc, 0x0, 0xff, 0x8f, 0xfc, 0xc0,
-        0xfc, 0x3, 0xc0, 0x3c, 0x3, 0x60, 0xc7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0037 "7" */
-        0xff, 0xff, 0xff, 0x0, 0x30, 0x3, 0x0, 0x30,
-        0x3, 0x0, 0xf0, 0x1e, 0x3, 0xc0, 0x78, 0x6,
-        0x0, 0x60, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60,
-        0x6, 0x0,
-
-        /* U+0038 "8" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x36, 0xc, 0x7f, 0xc7, 0xfc, 0xe0,
-        0xfc, 0x3, 0xc0, 0x3c, 0x3, 0x60, 0xc7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0039 "9" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x36, 0x3, 0x7f, 0xf3, 0xff, 0x0,
-        0x30, 0x3, 0x0, 0x3c, 0x3, 0xe0, 0xf7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0041 "A" */
-        0x6, 0x0, 0x60, 0x1f, 0x3, 0x98, 0x79, 0xe6,
-        0xe, 0x40, 0x2c, 0x3, 0xc0, 0x3c, 0x3, 0xff,
-        0xff, 0xff, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3,
-        0xc0, 0x30,
-
-        /* U+0042 "B" */
-        0xff, 0xcf, 0xfc, 0xc0, 0x6c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x6, 0xff, 0xef, 0xfe, 0xc0,
-        0x7c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x6f, 0xfe,
-        0xff, 0xc0,
-
-        /* U+0043 "C" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0,
-        0xc, 0x0, 0xc0, 0xc, 0x3, 0xe0, 0xf7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0044 "D" */
-        0xff, 0xcf, 0xfc, 0xc0, 0x6c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0,
-        0x3c, 0x3, 0xc0, 0x3c, 0x2, 0xc0, 0x6f, 0xfe,
-        0xff, 0xc0,
-
-        /* U+0045 "E" */
-        0xff, 0xff, 0xff, 0xc0, 0xc, 0x0, 0xc0, 0xc,
-        0x0, 0xc0, 0xc, 0x0, 0xff, 0xcf, 0xfc, 0xc0,
-        0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xf, 0xff,
-        0xff, 0xf0,
-
-        /* U+0046 "F" */
-        0xff, 0xff, 0xff, 0xc0, 0xc, 0x0, 0xc0, 0xc,
-        0x0, 0xc0, 0xc, 0x0, 0xff, 0xcf, 0xfc, 0xc0,
-        0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0,
-        0xc0, 0x0,
-
-        /* U+0047 "G" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x0, 0xc0, 0xc, 0x0, 0xc7, 0xfc, 0x7f, 0xc0,
-        0x3c, 0x3, 0xc0, 0x34, 0x4, 0x60, 0xc7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0048 "H" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xff, 0xff, 0xff, 0xc0,
-        0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3,
-        0xc0, 0x30,
-
-        /* U+0049 "I" */
-        0xff, 0xfc, 0x60, 0xc1, 0x83, 0x6, 0xc, 0x18,
-        0x30, 0x60, 0xc1, 0x83, 0x6, 0x7f, 0xfe,
-
-        /* U+004A "J" */
-        0x7, 0xf0, 0x7f, 0x1, 0x80, 0x18, 0x1, 0x80,
-        0x18, 0x1, 0x80, 0x18, 0x1, 0x80, 0x18, 0x1,
-        0x80, 0x18, 0x1, 0x8c, 0x18, 0xf3, 0x87, 0xf0,
-        0x3e, 0x0,
-
-        /* U+004B "K" */
-        0xc0, 0x3c, 0x3, 0xc0, 0xec, 0x1c, 0xc3, 0xcc,
-        0xf0, 0xce, 0xd, 0xc0, 0xfc, 0xf, 0xc0, 0xde,
-        0xc, 0xf0, 0xc3, 0xc, 0x1c, 0xc0, 0xec, 0xf,
-        0xc0, 0x30,
-
-        /* U+004C "L" */
-        0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc,
-        0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0,
-        0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xf, 0xff,
-        0xff, 0xf0,
-
-        /* U+004D "M" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3e, 0xf, 0xf9, 0xff,
-        0x9f, 0xdf, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc0,
-        0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3,
-        0xc0, 0x30,
-
-        /* U+004E "N" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xe0, 0x3e,
-        0x3, 0xf0, 0x3d, 0xc3, 0xde, 0x3c, 0xf3, 0xc7,
-        0xfc, 0x1f, 0xc0, 0xfc, 0x3, 0xc0, 0x3c, 0x3,
-        0xc0, 0x30,
-
-        /* U+004F "O" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0,
-        0x3c, 0x3, 0xc0, 0x34, 0x4, 0x60, 0xc7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0050 "P" */
-        0xff, 0xcf, 0xfc, 0xc0, 0x6c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x6, 0xff, 0xef, 0xfc, 0xc0,
-        0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0,
-        0xc0, 0x0,
-
-        /* U+0051 "Q" */
-        0x3f, 0x83, 0xf8, 0x70, 0xcc, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc6,
-        0x3c, 0x63, 0xc3, 0x34, 0x1c, 0x71, 0xc7, 0xff,
-        0x3e, 0x30,
-
-        /* U+0052 "R" */
-        0xff, 0xcf, 0xfc, 0xc0, 0xec, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0xe, 0xff, 0xef, 0xfc, 0xde,
-        0xc, 0xf0, 0xcf, 0xc, 0x3c, 0xc0, 0xec, 0xf,
-        0xc0, 0x30,
-
-        /* U+0053 "S" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x0, 0xc0, 0x6, 0x0, 0x7f, 0x83, 0xfc, 0x0,
-        0xc0, 0x3, 0x0, 0x3c, 0x3, 0xe0, 0xf7, 0xfc,
-        0x3f, 0x80,
-
-        /* U+0054 "T" */
-        0xff, 0xff, 0xff, 0x6, 0x0, 0x60, 0x6, 0x0,
-        0x60, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60, 0x6,
-        0x0, 0x60, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60,
-        0x6, 0x0,
-
-        /* U+0055 "U" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0,
-        0x3c, 0x3, 0xc0, 0x3c, 0x3, 0x60, 0xc3, 0xf8,
-        0x3f, 0x80,
-
-        /* U+0056 "V" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0x40,
-        0x22, 0xc, 0x20, 0x83, 0x98, 0x1f, 0x1, 0xf0,
-        0x6, 0x0,
-
-        /* U+0057 "W" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc6, 0x3c, 0x63, 0xc6,
-        0x3c, 0x63, 0xc6, 0x3c, 0x63, 0x7f, 0xc7, 0xfc,
-        0x19, 0x80,
-
-        /* U+0058 "X" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0x60, 0xe3,
-        0x98, 0x39, 0x81, 0xf0, 0x1f, 0x1, 0xf0, 0x3f,
-        0x83, 0x98, 0x60, 0xec, 0x3, 0xc0, 0x3c, 0x3,
-        0xc0, 0x30,
-
-        /* U+0059 "Y" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x36, 0xe, 0x39, 0x83, 0xf8, 0x1f,
-        0x0, 0x60, 0x6, 0x0, 0x60, 0x6, 0x0, 0x60,
-        0x6, 0x0,
-
-        /* U+005A "Z" */
-        0xff, 0xff, 0xff, 0x0, 0x30, 0x3, 0x0, 0xf0,
-        0xf, 0x1, 0xe0, 0x30, 0x7, 0x1, 0xe0, 0x3c,
-        0x7, 0x80, 0xe0, 0xc, 0x0, 0xc0, 0xf, 0xff,
-        0xff, 0xf0,
-
-        /* U+0061 "a" */
-        0x3f, 0x83, 0xfe, 0x0, 0xe0, 0x2, 0x0, 0x33,
-        0xf3, 0x7f, 0xfe, 0xf, 0xc0, 0x3c, 0x3, 0xc0,
-        0x36, 0xf, 0x7f, 0xf3, 0xf7,
-
-        /* U+0062 "b" */
-        0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xcf, 0xc,
-        0xf0, 0xcd, 0x8f, 0xe, 0xf0, 0xfe, 0x3, 0xe0,
-        0x3e, 0x3, 0xe0, 0x3f, 0xe, 0xfd, 0xec, 0xf8,
-        0xcf, 0x0,
-
-        /* U+0063 "c" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc, 0x3, 0xe0,
-        0xf7, 0xfc, 0x3f, 0x80,
-
-        /* U+0064 "d" */
-        0x0, 0x30, 0x3, 0x0, 0x30, 0x3, 0x1e, 0x31,
-        0xe3, 0x3b, 0x36, 0x1f, 0xe1, 0xfc, 0x7, 0xc0,
-        0x7c, 0x7, 0xc0, 0x76, 0x1f, 0x7b, 0xf3, 0xf3,
-        0x1e, 0x30,
-
-        /* U+0065 "e" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3f,
-        0xff, 0xff, 0xcc, 0x0, 0xc0, 0xc, 0x0, 0xe0,
-        0xf7, 0xfc, 0x3f, 0x80,
-
-        /* U+0066 "f" */
-        0x7, 0xc1, 0xf0, 0xc0, 0x30, 0xff, 0xff, 0xf0,
-        0xc0, 0x30, 0xc, 0x3, 0x0, 0xc0, 0x30, 0xc,
-        0x3, 0x0, 0xc0, 0x30, 0xc, 0x0,
-
-        /* U+0067 "g" */
-        0x3f, 0x87, 0xfc, 0x60, 0xcc, 0x3, 0xc0, 0x3e,
-        0xf, 0x7f, 0xf3, 0xf3, 0x0, 0x30, 0x3, 0x0,
-        0x36, 0xf, 0x7f, 0xc3, 0xf8,
-
-        /* U+0068 "h" */
-        0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xcf, 0xc,
-        0xf0, 0xdd, 0x8f, 0xe, 0xf0, 0xfe, 0x3, 0xc0,
-        0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3,
-        0xc0, 0x30,
-
-        /* U+0069 "i" */
-        0x18, 0x18, 0x0, 0x0, 0x0, 0xf8, 0xf8, 0x18,
-        0x18, 0x18, 0x18, 0x18, 0x1e, 0xf, 0x3,
-
-        /* U+006A "j" */
-        0x6, 0xc, 0x0, 0x3, 0xe7, 0xc1, 0x83, 0x6,
-        0xc, 0x18, 0x30, 0x60, 0xc3, 0xfe, 0xf8,
-
-        /* U+006B "k" */
-        0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0, 0x3c,
-        0x3, 0xc0, 0xec, 0x3c, 0xc3, 0xcc, 0xf0, 0xde,
-        0xf, 0xf0, 0xf3, 0xe, 0x1c, 0xc0, 0xec, 0xf,
-        0xc0, 0x30,
-
-        /* U+006C "l" */
-        0xff, 0xff, 0xff, 0xff, 0xc0,
-
-        /* U+006D "m" */
-        0xdf, 0x8d, 0xf8, 0xe6, 0xee, 0x6f, 0xc6, 0x3c,
-        0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6,
-        0x3c, 0x63, 0xc6, 0x30,
-
-        /* U+006E "n" */
-        0xdf, 0x8d, 0xf8, 0xe0, 0xee, 0xf, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0,
-        0x3c, 0x3, 0xc0, 0x30,
-
-        /* U+006F "o" */
-        0x3f, 0x83, 0xf8, 0x60, 0xcc, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xe0,
-        0xf7, 0xfc, 0x3f, 0x80,
-
-        /* U+0070 "p" */
-        0xcf, 0x8f, 0xfe, 0xf8, 0xfe, 0x3, 0xe0, 0x3e,
-        0x3, 0xe0, 0x3f, 0x8f, 0xff, 0xec, 0xf8, 0xc0,
-        0xc, 0x0, 0xc0, 0xc, 0x0,
-
-        /* U+0071 "q" */
-        0x3f, 0x37, 0xff, 0xe1, 0xfc, 0x7, 0xc0, 0x7c,
-        0x7, 0xc0, 0x7e, 0x1f, 0x7f, 0xf3, 0xef, 0x0,
-        0x30, 0x3, 0x0, 0x30, 0x3,
-
-        /* U+0072 "r" */
-        0xc7, 0xcc, 0x7c, 0xcc, 0x6f, 0x83, 0xf8, 0x3f,
-        0x0, 0xc0, 0xc, 0x0, 0xc0, 0xc, 0x0, 0xc0,
-        0xc, 0x0, 0xc0, 0x0,
-
-        /* U+0073 "s" */
-        0x3f, 0x83, 0xf8, 0x70, 0xef, 0x3, 0xf0, 0x37,
-        0xe0, 0xf, 0x80, 0x38, 0x0, 0xec, 0xf, 0xf0,
-        0xf7, 0xfe, 0x3f, 0x80,
-
-        /* U+0074 "t" */
-        0x18, 0x30, 0x60, 0xcf, 0xff, 0xc6, 0xc, 0x18,
-        0x30, 0x60, 0xc1, 0x83, 0x3, 0x3, 0x6,
-
-        /* U+0075 "u" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0x60,
-        0xc3, 0xf8, 0x3f, 0x80,
-
-        /* U+0076 "v" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-        0x3, 0xc0, 0x3e, 0xf, 0x60, 0xe3, 0x98, 0x1f,
-        0x1, 0xf0, 0x6, 0x0,
-
-        /* U+0077 "w" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0xc0, 0x3c,
-        0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0x76,
-        0xc7, 0xfc, 0x19, 0x80,
-
-        /* U+0078 "x" */
-        0xc0, 0x3c, 0x3, 0x60, 0xe3, 0x98, 0x3f, 0x81,
-        0xf0, 0x6, 0x1, 0xf0, 0x1f, 0x3, 0x98, 0x60,
-        0xee, 0xf, 0xc0, 0x30,
-
-        /* U+0079 "y" */
-        0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x7, 0xc0, 0x7c,
-        0x1f, 0xe3, 0xf7, 0xf3, 0x3e, 0x30, 0x3, 0x0,
-        0x20, 0xc, 0x3f, 0x83, 0xf8,
-
-        /* U+007A "z" */
-        0xff, 0xff, 0xff, 0x0, 0xf0, 0xe, 0x1, 0xe0,
-        0x3c, 0x7, 0x1, 0xe0, 0x3c, 0x3, 0x80, 0x78,
-        0xf, 0xff, 0xff, 0xf0,
-
-        /* U+00B0 "°" */
-        0x3e, 0x3f, 0xb8, 0xf8, 0x3c, 0x1e, 0xd, 0x8c,
-        0xfe, 0x3e, 0x0};
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-        {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-        {.bitmap_index = 0, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 26, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 52, .adv_w = 225, .box_w = 7, .box_h = 17, .ofs_x = 4, .ofs_y = 1},
-        {.bitmap_index = 67, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 93, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 119, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 145, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 171, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 197, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 223, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 249, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 275, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 301, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 327, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 353, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 379, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 405, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 431, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 457, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 483, .adv_w = 225, .box_w = 7, .box_h = 17, .ofs_x = 4, .ofs_y = 1},
-        {.bitmap_index = 498, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 524, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 550, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 576, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 602, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 628, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 654, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 680, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 706, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 732, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 758, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 784, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 810, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 836, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 862, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 888, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 914, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 940, .adv_w = 225, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 961, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 987, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1007, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1033, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1053, .adv_w = 225, .box_w = 10, .box_h = 17, .ofs_x = 2, .ofs_y = 1},
-        {.bitmap_index = 1075, .adv_w = 225, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1096, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1122, .adv_w = 225, .box_w = 8, .box_h = 15, .ofs_x = 3, .ofs_y = 1},
-        {.bitmap_index = 1137, .adv_w = 225, .box_w = 7, .box_h = 17, .ofs_x = 4, .ofs_y = 1},
-        {.bitmap_index = 1152, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1178, .adv_w = 225, .box_w = 2, .box_h = 17, .ofs_x = 6, .ofs_y = 1},
-        {.bitmap_index = 1183, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1203, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1223, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1243, .adv_w = 225, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1264, .adv_w = 225, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1285, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1305, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1325, .adv_w = 225, .box_w = 7, .box_h = 17, .ofs_x = 4, .ofs_y = 1},
-        {.bitmap_index = 1340, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1360, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1380, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1400, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1420, .adv_w = 225, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1441, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1},
-        {.bitmap_index = 1461, .adv_w = 225, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 8}};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-        {
-                {.range_start = 37, .range_length = 1, .glyph_id_start = 1, .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
-                {.range_start = 48, .range_length = 10, .glyph_id_start = 2, .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
-                {.range_start = 65, .range_length = 26, .glyph_id_start = 12, .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
-                {.range_start = 97, .range_length = 26, .glyph_id_start = 38, .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY},
-                {.range_start = 176, .range_length = 1, .glyph_id_start = 64, .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY}};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
+// Generated by GenerateFonts.py from VCR_OSD_MONO_1.001.ttf at 24 px, don't edit
+#include "Fonts.h"
+
+// Project includes
+#include "FontAtlas.h"
+
+/*
+ *	Private variables
+ */
+//! \brief The bitmaps of all glyphs, 607 B of which 119 B keep glyphs within their cache lines
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t g_atlas[] __attribute__((aligned(32))) = {
+	// U+0030 "0"
+	0x3F, 0x83, 0xF8, 0x60, 0xCC, 0x03, 0xC0, 0x3C, 0x03, 0xC1, 0xFC, 0x7F, 0xCF, 0x3D, 0xE3, 0xFC,
+	0x3F, 0x03, 0xC0, 0x34, 0x04, 0x60, 0xC7, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0031 "1"
+	0x18, 0x31, 0xE7, 0xCF, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x7F, 0xFE, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0032 "2"
+	0x3F, 0x83, 0xF8, 0x60, 0xCC, 0x03, 0xC0, 0x30, 0x03, 0x00, 0x30, 0x0C, 0x3F, 0xC7, 0xF8, 0xE0,
+	0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0033 "3"
+	0x3F, 0x83, 0xF8, 0x60, 0xCC, 0x03, 0xC0, 0x30, 0x03, 0x00, 0x30, 0x0C, 0x0F, 0xC0, 0xFC, 0x00,
+	0xC0, 0x03, 0x00, 0x3C, 0x03, 0xE0, 0xF7, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0034 "4"
+	0x01, 0x80, 0x18, 0x03, 0x80, 0x78, 0x1F, 0x81, 0xD8, 0x79, 0x8F, 0x18, 0xF1, 0x8C, 0x18, 0xFF,
+	0xFF, 0xFF, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0035 "5"
+	0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xFF, 0x8F, 0xFC, 0x00, 0xF0, 0x03, 0x00,
+	0x30, 0x03, 0x00, 0x3C, 0x03, 0xE0, 0xF7, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0036 "6"
+	0x3F, 0x83, 0xF8, 0x60, 0xCC, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xFF, 0x8F, 0xFC, 0xC0,
+	0xFC, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0xC7, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0037 "7"
+	0xFF, 0xFF, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x06,
+	0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0038 "8"
+	0x3F, 0x83, 0xF8, 0x60, 0xCC, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x0C, 0x7F, 0xC7, 0xFC, 0xE0,
+	0xFC, 0x03, 0xC0, 0x3C, 0x03, 0x60, 0xC7, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0039 "9"
+	0x3F, 0x83, 0xF8, 0x60, 0xCC, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x03, 0x7F, 0xF3, 0xFF, 0x00,
+	0x30, 0x03, 0x00, 0x3C, 0x03, 0xE0, 0xF7, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0025 "%"
+	0x78, 0x37, 0x83, 0xCC, 0x3C, 0xC3, 0xCC, 0xEC, 0xCE, 0x7C, 0xC0, 0xB0, 0x07, 0x00, 0xF0, 0x3C,
+	0xE3, 0x8E, 0x73, 0x3C, 0x33, 0xC3, 0x3C, 0x3F, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0043 "C"
+	0x3F, 0x83, 0xF8, 0x60, 0xCC, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0,
+	0x0C, 0x00, 0xC0, 0x0C, 0x03, 0xE0, 0xF7, 0xFC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+004C "L"
+	0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0,
+	0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+004D "M"
+	0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x0F, 0xF9, 0xFF, 0x9F, 0xDF, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC0,
+	0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0050 "P"
+	0xFF, 0xCF, 0xFC, 0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x06, 0xFF, 0xEF, 0xFC, 0xC0,
+	0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0052 "R"
+	0xFF, 0xCF, 0xFC, 0xC0, 0xEC, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x0E, 0xFF, 0xEF, 0xFC, 0xDE,
+	0x0C, 0xF0, 0xCF, 0x0C, 0x3C, 0xC0, 0xEC, 0x0F, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+0068 "h"
+	0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xCF, 0x0C, 0xF0, 0xDD, 0x8F, 0x0E, 0xF0, 0xFE, 0x03, 0xC0,
+	0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+006B "k"
+	0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x3C, 0x03, 0xC0, 0xEC, 0x3C, 0xC3, 0xCC, 0xF0, 0xDE,
+	0x0F, 0xF0, 0xF3, 0x0E, 0x1C, 0xC0, 0xEC, 0x0F, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// U+006D "m"
+	0xDF, 0x8D, 0xF8, 0xE6, 0xEE, 0x6F, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC6,
+	0x3C, 0x63, 0xC6, 0x30,
+	// U+00B0 "°"
+	0x3E, 0x3F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0D, 0x8C, 0xFE, 0x3E, 0x00,
+};
 
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static lv_font_fmt_txt_glyph_cache_t cache;
-#endif
+//! \brief Glyph id 0 is reserved, the digits start at 1 if the font has all of them
+static const lv_font_fmt_txt_glyph_dsc_t g_glyphs[] = {
+	{.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+	{.bitmap_index = 0, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0030 "0"
+	{.bitmap_index = 32, .adv_w = 225, .box_w = 7, .box_h = 17, .ofs_x = 4, .ofs_y = 1}, // U+0031 "1"
+	{.bitmap_index = 64, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0032 "2"
+	{.bitmap_index = 96, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0033 "3"
+	{.bitmap_index = 128, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0034 "4"
+	{.bitmap_index = 160, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0035 "5"
+	{.bitmap_index = 192, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0036 "6"
+	{.bitmap_index = 224, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0037 "7"
+	{.bitmap_index = 256, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0038 "8"
+	{.bitmap_index = 288, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0039 "9"
+	{.bitmap_index = 320, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0025 "%"
+	{.bitmap_index = 352, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0043 "C"
+	{.bitmap_index = 384, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+004C "L"
+	{.bitmap_index = 416, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+004D "M"
+	{.bitmap_index = 448, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0050 "P"
+	{.bitmap_index = 480, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0052 "R"
+	{.bitmap_index = 512, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+0068 "h"
+	{.bitmap_index = 544, .adv_w = 225, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 1}, // U+006B "k"
+	{.bitmap_index = 576, .adv_w = 225, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 1}, // U+006D "m"
+	{.bitmap_index = 596, .adv_w = 225, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 8}, // U+00B0 "°"
+};
 
-#if LVGL_VERSION_MAJOR >= 8
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-        .glyph_bitmap = glyph_bitmap,
-        .glyph_dsc = glyph_dsc,
-        .cmaps = cmaps,
-        .kern_dsc = NULL,
-        .kern_scale = 0,
-        .cmap_num = 5,
-        .bpp = 1,
-        .kern_classes = 0,
-        .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
-        .cache = &cache
-#endif
+//! \brief Glyph ids of everything but the digits, sorted by code point
+static const FontAtlasGlyph_t g_otherGlyphs[] = {
+	{0x0025, 11}, // U+0025 "%"
+	{0x0043, 12}, // U+0043 "C"
+	{0x004C, 13}, // U+004C "L"
+	{0x004D, 14}, // U+004D "M"
+	{0x0050, 15}, // U+0050 "P"
+	{0x0052, 16}, // U+0052 "R"
+	{0x0068, 17}, // U+0068 "h"
+	{0x006B, 18}, // U+006B "k"
+	{0x006D, 19}, // U+006D "m"
+	{0x00B0, 20}, // U+00B0 "°"
 };
 
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
+static const FontAtlas_t g_fontAtlas = {
+	.base =
+		{
+			.glyph_bitmap = g_atlas,
+			.glyph_dsc = g_glyphs,
+			.cmaps = NULL,
+			.kern_dsc = NULL,
+			.kern_scale = 0,
+			.cmap_num = 0,
+			.bpp = 1,
+			.kern_classes = 0,
+			.bitmap_format = 0,
+		},
+	.glyphAmount = 21,
+	.bitmapSizeB = 607,
+	.firstDigitGlyph = 1,
+	.p_otherGlyphs = g_otherGlyphs,
+	.otherGlyphAmount = 10,
+};
 
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
+/*
+ *	Public variables
+ */
 const lv_font_t VCR_OSD_MONO_24_FONT = {
-#else
-lv_font_t VCR_OSD_MONO_24 = {
-#endif
-        .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt, /*Function pointer to get glyph's data*/
-        .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt, /*Function pointer to get glyph's bitmap*/
-        .line_height = 17,                              /*The maximum line height required by the font*/
-        .base_line = -1,                                /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-        .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-        .underline_position = -3,
-        .underline_thickness = 2,
-#endif
-        .dsc = &font_dsc, /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
-        .fallback = NULL,
-#endif
-        .user_data = NULL,
+	.get_glyph_dsc = fontAtlasGetGlyphDsc,
+	.get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+	.line_height = 17,
+	.base_line = -1,
+	.subpx = LV_FONT_SUBPX_NONE,
+	.underline_position = -3,
+	.underline_thickness = 2,
+	.dsc = &g_fontAtlas,
+	.fallback = NULL,
+	.user_data = NULL,
 };
-
-#endif /*#if VCR_OSD_MONO_24*/
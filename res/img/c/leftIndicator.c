@@ -1,3681 +0,0 @@
-#ifdef __has_include
-#if __has_include("lvgl.h")
-#ifndef LV_LVGL_H_INCLUDE_SIMPLE
-#define LV_LVGL_H_INCLUDE_SIMPLE
-#endif
-#endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_LEFTINDICATOR
-#define LV_ATTRIBUTE_IMAGE_LEFTINDICATOR
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_LEFTINDICATOR uint8_t leftIndicator_map[] = {
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x2b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x0c,
-        0x85,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x2b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x6b,
-        0x85,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x2b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x0c,
-        0x85,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x2b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x6b,
-        0x85,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x2b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x0c,
-        0x85,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x2b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x6b,
-        0x85,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x2b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x0c,
-        0x85,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x2b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x4b,
-        0x7d,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x00,
-        0x4c,
-        0x7d,
-        0x4b,
-        0x7d,
-};
-
-const lv_image_dsc_t leftIndicator = {
-        .header.cf = LV_COLOR_FORMAT_RGB565,
-        .header.magic = LV_IMAGE_HEADER_MAGIC,
-        .header.w = 38,
-        .header.h = 48,
-        .data_size = 1824 * 2,
-        .data = leftIndicator_map,
-};
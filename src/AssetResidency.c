@@ -0,0 +1,416 @@
+#include "AssetResidency.h"
+
+// Project includes
+#include "FontAtlas.h"
+#include "Fonts.h"
+#include "Images.h"
+
+// C includes
+#include <string.h>
+
+// espidf includes
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+
+// FreeRTOS include
+#include "freertos/FreeRTOS.h"
+
+/*
+ *	Private defines
+ */
+//! \brief Most image objects or styles which can follow one asset
+#define ASSET_MAX_USERS 6
+
+#define SCREEN_BIT(screen) (1U << (screen))
+
+/*
+ *	Private typedefs
+ */
+typedef enum {
+	ASSET_TYPE_IMAGE,
+	ASSET_TYPE_FONT
+} AssetType_t;
+
+//! \brief An asset in flash and the screens drawing it
+typedef struct
+{
+	AssetType_t type;
+
+	//! \brief The lv_image_dsc_t or lv_font_t in flash
+	const void* p_source;
+
+	//! \brief One bit per Screen_t
+	uint8_t screens;
+} AssetDescription_t;
+
+//! \brief Where an asset currently lives and who shows it
+typedef struct
+{
+	//! \brief The copy in internal RAM, NULL while the asset is read from flash
+	void* p_copy;
+	uint32_t copySizeB;
+
+	//! \brief The image objects or styles, depending on the type
+	void* p_users[ASSET_MAX_USERS];
+	uint8_t userAmount;
+} AssetState_t;
+
+//! \brief Internal RAM copy of a generated font, the glyph descriptions, glyph table and bitmaps follow it
+typedef struct
+{
+	lv_font_t font;
+	FontAtlas_t atlas;
+} FontCopy_t;
+
+/*
+ *	Private variables
+ */
+//! \brief The assets read from flash while a screen is drawn, in the order they are loaded if the budget is tight.
+//! The E1234 digits aren't listed, LvglDigitDisplay renders them once into internal RAM outside of the LVGL heap.
+//! Neither is the right indicator of the speed screen, its mirrored copy is allocated the same way
+static const AssetDescription_t g_assets[] = {
+	// Labels of all screens, the fuel level and unit labels are redrawn with every sensor update
+	{ASSET_TYPE_FONT, &VCR_OSD_MONO_24_FONT,
+	 SCREEN_BIT(SCREEN_TEMPERATURE) | SCREEN_BIT(SCREEN_SPEED) | SCREEN_BIT(SCREEN_RPM)},
+	// Redrawn whenever the indicator toggles
+	{ASSET_TYPE_IMAGE, &leftIndicator, SCREEN_BIT(SCREEN_RPM)},
+};
+
+#define ASSET_AMOUNT (sizeof(g_assets) / sizeof(g_assets[0]))
+
+static AssetState_t g_states[ASSET_AMOUNT] = {0};
+
+//! \brief The screen whose assets are loaded
+static Screen_t g_currentScreen = SCREEN_UNKNOWN;
+
+//! \brief Protects the statistics, everything else is guarded by the LVGL semaphore
+static portMUX_TYPE g_statisticsLock = portMUX_INITIALIZER_UNLOCKED;
+
+static AssetResidencyStatistics_t g_statistics = {.budgetB = ASSET_RESIDENCY_DEFAULT_BUDGET_B};
+
+/*
+ *	Prototypes
+ */
+//! \brief Finds an asset by its flash address
+//! \param p_source The asset in flash
+//! \retval The index or -1 if it isn't managed
+static int32_t findAsset(const void* p_source);
+
+//! \brief Computes the size of the internal RAM copy of an asset
+//! \param p_asset The asset
+//! \retval The size in bytes, 0 if it can't be copied
+static uint32_t getCopySize(const AssetDescription_t* p_asset);
+
+//! \brief Copies an image with its pixels into one block
+//! \param p_memory The block
+//! \param p_source The image in flash
+static void copyImage(void* p_memory, const lv_image_dsc_t* p_source);
+
+//! \brief Copies a generated font with its glyphs and bitmaps into one block
+//! \param p_memory The block
+//! \param p_source The font in flash
+static void copyFont(void* p_memory, const lv_font_t* p_source);
+
+//! \brief Points all users of an asset at its copy or, without one, at flash
+//! \param index Index of the asset
+static void applyToUsers(uint32_t index);
+
+//! \brief Adds a user to an asset
+//! \param index Index of the asset
+//! \param p_user The image object or style
+//! \retval Bool indicating if there was room for it
+static bool addUser(uint32_t index, void* p_user);
+
+//! \brief Removes a user from all assets
+//! \param p_user The image object or style
+static void removeUser(const void* p_user);
+
+//! \brief Copies an asset into internal RAM if the budget allows it
+//! \param index Index of the asset
+static void loadAsset(uint32_t index);
+
+//! \brief Frees the copy of an asset after its users were pointed back at flash
+//! \param index Index of the asset
+static void evictAsset(uint32_t index);
+
+//! \brief Unbinds an image object when it is deleted
+//! \param p_event The LVGL event
+static void onImageDeleted(lv_event_t* p_event);
+
+/*
+ *	Private function implementations
+ */
+static int32_t findAsset(const void* p_source)
+{
+	for (uint32_t i = 0; i < ASSET_AMOUNT; i++) {
+		if (g_assets[i].p_source == p_source) {
+			return (int32_t)i;
+		}
+	}
+
+	return -1;
+}
+
+static uint32_t getCopySize(const AssetDescription_t* p_asset)
+{
+	if (p_asset->type == ASSET_TYPE_IMAGE) {
+		const lv_image_dsc_t* p_image = p_asset->p_source;
+		return sizeof(lv_image_dsc_t) + p_image->data_size;
+	}
+
+	// Only the generated fonts know the size of their glyph data
+	const lv_font_t* p_font = p_asset->p_source;
+	if (p_font->get_glyph_dsc != fontAtlasGetGlyphDsc) {
+		return 0;
+	}
+
+	const FontAtlas_t* p_atlas = p_font->dsc;
+	return sizeof(FontCopy_t) + p_atlas->glyphAmount * sizeof(lv_font_fmt_txt_glyph_dsc_t) +
+		   p_atlas->otherGlyphAmount * sizeof(FontAtlasGlyph_t) + p_atlas->bitmapSizeB;
+}
+
+static void copyImage(void* p_memory, const lv_image_dsc_t* p_source)
+{
+	lv_image_dsc_t* p_image = p_memory;
+	uint8_t* p_data = (uint8_t*)(p_image + 1);
+
+	*p_image = *p_source;
+	memcpy(p_data, p_source->data, p_source->data_size);
+	p_image->data = p_data;
+}
+
+static void copyFont(void* p_memory, const lv_font_t* p_source)
+{
+	const FontAtlas_t* p_sourceAtlas = p_source->dsc;
+
+	FontCopy_t* p_copy = p_memory;
+	lv_font_fmt_txt_glyph_dsc_t* p_glyphs = (lv_font_fmt_txt_glyph_dsc_t*)(p_copy + 1);
+	FontAtlasGlyph_t* p_otherGlyphs = (FontAtlasGlyph_t*)(p_glyphs + p_sourceAtlas->glyphAmount);
+	uint8_t* p_bitmaps = (uint8_t*)(p_otherGlyphs + p_sourceAtlas->otherGlyphAmount);
+
+	memcpy(p_glyphs, p_sourceAtlas->base.glyph_dsc, p_sourceAtlas->glyphAmount * sizeof(lv_font_fmt_txt_glyph_dsc_t));
+	if (p_sourceAtlas->otherGlyphAmount > 0) {
+		memcpy(p_otherGlyphs, p_sourceAtlas->p_otherGlyphs, p_sourceAtlas->otherGlyphAmount * sizeof(FontAtlasGlyph_t));
+	}
+	memcpy(p_bitmaps, p_sourceAtlas->base.glyph_bitmap, p_sourceAtlas->bitmapSizeB);
+
+	// Same font, only every table points into the copy
+	p_copy->atlas = *p_sourceAtlas;
+	p_copy->atlas.base.glyph_dsc = p_glyphs;
+	p_copy->atlas.base.glyph_bitmap = p_bitmaps;
+	p_copy->atlas.p_otherGlyphs = p_otherGlyphs;
+
+	p_copy->font = *p_source;
+	p_copy->font.dsc = &p_copy->atlas;
+}
+
+static void applyToUsers(const uint32_t index)
+{
+	const AssetState_t* p_state = &g_states[index];
+	const void* p_current = p_state->p_copy != NULL ? p_state->p_copy : g_assets[index].p_source;
+
+	for (uint8_t i = 0; i < p_state->userAmount; i++) {
+		if (g_assets[index].type == ASSET_TYPE_IMAGE) {
+			lv_image_set_src(p_state->p_users[i], p_current);
+		} else {
+			lv_style_set_text_font(p_state->p_users[i], p_current);
+
+			// The objects using the style have to measure their text again
+			lv_obj_report_style_change(p_state->p_users[i]);
+		}
+	}
+}
+
+static bool addUser(const uint32_t index, void* p_user)
+{
+	AssetState_t* p_state = &g_states[index];
+	if (p_state->userAmount >= ASSET_MAX_USERS) {
+		ESP_LOGW("AssetResidency", "Asset %lu has too many users, the new one reads from flash",
+				 (unsigned long)index);
+
+		return false;
+	}
+
+	p_state->p_users[p_state->userAmount++] = p_user;
+
+	return true;
+}
+
+static void removeUser(const void* p_user)
+{
+	for (uint32_t i = 0; i < ASSET_AMOUNT; i++) {
+		AssetState_t* p_state = &g_states[i];
+		for (uint8_t j = 0; j < p_state->userAmount; j++) {
+			if (p_state->p_users[j] == p_user) {
+				p_state->p_users[j] = p_state->p_users[--p_state->userAmount];
+				break;
+			}
+		}
+	}
+}
+
+static void loadAsset(const uint32_t index)
+{
+	AssetState_t* p_state = &g_states[index];
+	if (p_state->p_copy != NULL) {
+		return;
+	}
+
+	const uint32_t sizeB = getCopySize(&g_assets[index]);
+	if (sizeB == 0) {
+		return;
+	}
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	const bool fits = g_statistics.residentB + sizeB <= g_statistics.budgetB;
+	if (!fits) {
+		g_statistics.skippedLoads++;
+	}
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	if (!fits) {
+		return;
+	}
+
+	// PSRAM is read through the same cache as flash, so only internal RAM takes load off the cache
+	void* p_memory = heap_caps_malloc(sizeB, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (p_memory == NULL) {
+		ESP_LOGW("AssetResidency", "No internal RAM for asset %lu (%lu B), it stays in flash", (unsigned long)index,
+				 (unsigned long)sizeB);
+
+		taskENTER_CRITICAL(&g_statisticsLock);
+		g_statistics.skippedLoads++;
+		taskEXIT_CRITICAL(&g_statisticsLock);
+
+		return;
+	}
+
+	if (g_assets[index].type == ASSET_TYPE_IMAGE) {
+		copyImage(p_memory, g_assets[index].p_source);
+	} else {
+		copyFont(p_memory, g_assets[index].p_source);
+	}
+
+	p_state->p_copy = p_memory;
+	p_state->copySizeB = sizeB;
+	applyToUsers(index);
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	g_statistics.residentB += sizeB;
+	g_statistics.residentAssets++;
+	g_statistics.loads++;
+	taskEXIT_CRITICAL(&g_statisticsLock);
+}
+
+static void evictAsset(const uint32_t index)
+{
+	AssetState_t* p_state = &g_states[index];
+	if (p_state->p_copy == NULL) {
+		return;
+	}
+
+	// Nothing may point at the copy once it is freed
+	void* p_memory = p_state->p_copy;
+	p_state->p_copy = NULL;
+	applyToUsers(index);
+	heap_caps_free(p_memory);
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	g_statistics.residentB -= p_state->copySizeB;
+	g_statistics.residentAssets--;
+	g_statistics.evictions++;
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	p_state->copySizeB = 0;
+}
+
+static void onImageDeleted(lv_event_t* p_event)
+{
+	removeUser(lv_event_get_target(p_event));
+}
+
+/*
+ *	Public function implementations
+ */
+bool assetResidencyBindImage(lv_obj_t* p_image, const lv_image_dsc_t* p_source)
+{
+	const int32_t index = findAsset(p_source);
+	if (index < 0 || g_assets[index].type != ASSET_TYPE_IMAGE || !addUser(index, p_image)) {
+		lv_image_set_src(p_image, p_source);
+
+		return false;
+	}
+
+	lv_obj_add_event_cb(p_image, onImageDeleted, LV_EVENT_DELETE, NULL);
+	lv_image_set_src(p_image, g_states[index].p_copy != NULL ? g_states[index].p_copy : p_source);
+
+	return true;
+}
+
+bool assetResidencyBindFont(lv_style_t* p_style, const lv_font_t* p_font)
+{
+	const int32_t index = findAsset(p_font);
+	if (index < 0 || g_assets[index].type != ASSET_TYPE_FONT || !addUser(index, p_style)) {
+		lv_style_set_text_font(p_style, p_font);
+
+		return false;
+	}
+
+	lv_style_set_text_font(p_style, g_states[index].p_copy != NULL ? g_states[index].p_copy : p_font);
+
+	return true;
+}
+
+void assetResidencyUnbindFont(lv_style_t* p_style)
+{
+	removeUser(p_style);
+}
+
+void assetResidencyLoadScreen(const Screen_t screen)
+{
+	g_currentScreen = screen;
+	const uint8_t screenBit = screen < SCREEN_UNKNOWN ? SCREEN_BIT(screen) : 0;
+
+	// Evict first, so the whole budget is available to the new screen
+	for (uint32_t i = 0; i < ASSET_AMOUNT; i++) {
+		if ((g_assets[i].screens & screenBit) == 0) {
+			evictAsset(i);
+		}
+	}
+
+	for (uint32_t i = 0; i < ASSET_AMOUNT; i++) {
+		if ((g_assets[i].screens & screenBit) != 0) {
+			loadAsset(i);
+		}
+	}
+}
+
+void assetResidencySetBudget(const uint32_t budgetB)
+{
+	taskENTER_CRITICAL(&g_statisticsLock);
+	g_statistics.budgetB = budgetB;
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	// Start over, otherwise a smaller budget would keep copies loaded under the larger one
+	for (uint32_t i = 0; i < ASSET_AMOUNT; i++) {
+		evictAsset(i);
+	}
+
+	assetResidencyLoadScreen(g_currentScreen);
+
+	AssetResidencyStatistics_t statistics;
+	assetResidencyGetStatistics(&statistics);
+	ESP_LOGI("AssetResidency", "Budget %lu B, %lu B resident", (unsigned long)budgetB,
+			 (unsigned long)statistics.residentB);
+}
+
+void assetResidencyGetStatistics(AssetResidencyStatistics_t* p_statistics)
+{
+	if (p_statistics == NULL) {
+		return;
+	}
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	memcpy(p_statistics, &g_statistics, sizeof(AssetResidencyStatistics_t));
+	taskEXIT_CRITICAL(&g_statisticsLock);
+}
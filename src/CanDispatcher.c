@@ -0,0 +1,192 @@
+#include "CanDispatcher.h"
+
+// Project includes
+#include "TaskTopology.h"
+#include "can.h"
+
+// C includes
+#include <string.h>
+
+// espidf includes
+#include <esp_log.h>
+
+/*
+ *	Private defines
+ */
+//! \brief Maximum time the dispatcher waits for space in a full subscribed channel
+#define CAN_DISPATCHER_SEND_TIMEOUT_MS 10
+
+//! \brief Amount of possible message ids (the CAN id is 29 bits, the lower 21 bits are the sender)
+#define CAN_MESSAGE_ID_COUNT 256
+
+//! \brief Mask of the sender bits of the CAN id
+#define CAN_SENDER_ID_MASK 0x1FFFFF
+
+/*
+ *	Private typedefs
+ */
+typedef struct
+{
+	//! \brief Bool indicating if the slot is taken
+	bool used;
+
+	//! \brief The channel the messages are published to
+	EventChannel_t channel;
+
+	//! \brief The sender the subscriber is interested in
+	uint32_t senderId;
+} CanSubscriber_t;
+
+/*
+ *	Private variables
+ */
+//! \brief All subscribers
+static CanSubscriber_t g_subscribers[CAN_DISPATCHER_MAX_SUBSCRIBERS];
+
+//! \brief Routing table: one bit per subscriber for every message id
+static uint8_t g_routes[CAN_MESSAGE_ID_COUNT];
+
+//! \brief Spinlock protecting the routing table and the subscribers
+static portMUX_TYPE g_routesLock = portMUX_INITIALIZER_UNLOCKED;
+
+//! \brief Amount of messages which could not be delivered
+static uint32_t g_droppedCount = 0;
+
+/*
+ *	Tasks
+ */
+//! \brief Task which decodes every received frame once and routes it to the subscribers
+//! \param p_param Unused parameters
+static void dispatcherTask(void* p_param)
+{
+	TwaiFrame_t rxFrame;
+	while (true) {
+		// Wait until we get a new frame
+		if (!EVENT_BUS_RECEIVE(CAN_RX, &rxFrame, portMAX_DELAY)) {
+			continue;
+		}
+
+		// Decode the frame
+		CanMessage_t message;
+		message.messageId = rxFrame.espidfFrame.header.id >> CAN_FRAME_ID_OFFSET;
+		message.senderId = rxFrame.espidfFrame.header.id & CAN_SENDER_ID_MASK;
+		message.dlc = rxFrame.espidfFrame.header.dlc;
+		if (message.dlc > sizeof(message.buffer)) {
+			message.dlc = sizeof(message.buffer);
+		}
+		memcpy(message.buffer, rxFrame.buffer, sizeof(message.buffer));
+
+		// Collect the interested subscribers
+		EventChannel_t receivers[CAN_DISPATCHER_MAX_SUBSCRIBERS];
+		uint8_t receiverCount = 0;
+
+		taskENTER_CRITICAL(&g_routesLock);
+		const uint8_t route = g_routes[message.messageId];
+		for (uint8_t i = 0; i < CAN_DISPATCHER_MAX_SUBSCRIBERS; i++) {
+			if ((route & (1 << i)) == 0 || !g_subscribers[i].used) {
+				continue;
+			}
+			if (g_subscribers[i].senderId != CAN_SENDER_ANY && g_subscribers[i].senderId != message.senderId) {
+				continue;
+			}
+			receivers[receiverCount++] = g_subscribers[i].channel;
+		}
+		taskEXIT_CRITICAL(&g_routesLock);
+
+		// Deliver the message, subscribing checked that every channel carries CanMessage_t
+		for (uint8_t i = 0; i < receiverCount; i++) {
+			if (!eventBusPublishUnchecked(receivers[i], &message, pdMS_TO_TICKS(CAN_DISPATCHER_SEND_TIMEOUT_MS))) {
+				g_droppedCount++;
+			}
+		}
+	}
+}
+
+/*
+ *	Public function implementations
+ */
+bool canDispatcherInit()
+{
+	// Register to the CAN rx cb. The CAN_RX channel is the only queue the CAN driver copies frames into
+	if (!canRegisterRxCbQueue(eventBusGetQueue(EVENT_CHANNEL_CAN_RX))) {
+		ESP_LOGE("CanDispatcher", "Couldn't register rx cb queue");
+
+		return false;
+	}
+
+	// Start the dispatcher task
+	if (!taskTopologyCreate(TASK_CAN_DISPATCHER, dispatcherTask, NULL, NULL)) {
+		ESP_LOGE("CanDispatcher", "Couldn't create dispatcher task!");
+
+		return false;
+	}
+
+	return true;
+}
+
+bool canDispatcherSubscribe(const EventChannel_t channel, const uint8_t* p_messageIds, const uint8_t amount,
+							const uint32_t senderId)
+{
+	if (channel >= EVENT_CHANNEL_AMOUNT || p_messageIds == NULL) {
+		ESP_LOGE("CanDispatcher", "Received invalid channel or NULL pointer to subscribe");
+
+		return false;
+	}
+
+	taskENTER_CRITICAL(&g_routesLock);
+
+	// Find the slot of the channel, or a free one
+	int8_t slot = -1;
+	for (uint8_t i = 0; i < CAN_DISPATCHER_MAX_SUBSCRIBERS; i++) {
+		if (g_subscribers[i].used && g_subscribers[i].channel == channel) {
+			slot = (int8_t)i;
+			break;
+		}
+		if (slot < 0 && !g_subscribers[i].used) {
+			slot = (int8_t)i;
+		}
+	}
+
+	if (slot < 0) {
+		taskEXIT_CRITICAL(&g_routesLock);
+		ESP_LOGE("CanDispatcher", "No free subscriber slot left");
+
+		return false;
+	}
+
+	// Add the routes
+	g_subscribers[slot].used = true;
+	g_subscribers[slot].channel = channel;
+	g_subscribers[slot].senderId = senderId;
+	for (uint8_t i = 0; i < amount; i++) {
+		g_routes[p_messageIds[i]] |= (uint8_t)(1 << slot);
+	}
+
+	taskEXIT_CRITICAL(&g_routesLock);
+
+	return true;
+}
+
+void canDispatcherUnsubscribe(const EventChannel_t channel)
+{
+	taskENTER_CRITICAL(&g_routesLock);
+
+	for (uint8_t slot = 0; slot < CAN_DISPATCHER_MAX_SUBSCRIBERS; slot++) {
+		if (!g_subscribers[slot].used || g_subscribers[slot].channel != channel) {
+			continue;
+		}
+
+		// Remove all routes of the subscriber
+		for (uint16_t id = 0; id < CAN_MESSAGE_ID_COUNT; id++) {
+			g_routes[id] &= (uint8_t)~(1 << slot);
+		}
+		g_subscribers[slot].used = false;
+	}
+
+	taskEXIT_CRITICAL(&g_routesLock);
+}
+
+uint32_t canDispatcherGetDroppedCount()
+{
+	return g_droppedCount;
+}
@@ -0,0 +1,158 @@
+#include "EventBus.h"
+
+// C includes
+#include <string.h>
+
+// espidf includes
+#include <esp_log.h>
+
+/*
+ *	Private typedefs
+ */
+typedef struct
+{
+	const char* p_name;
+	uint8_t* p_storage;
+	uint16_t depth;
+	uint16_t payloadSizeB;
+} ChannelDescription_t;
+
+/*
+ *	Private variables
+ */
+// The storage of every channel, g_<name>Storage
+#define EVENT_BUS_STORAGE(name, type, depth) static uint8_t g_##name##Storage[(depth) * sizeof(type)];
+EVENT_BUS_CHANNELS(EVENT_BUS_STORAGE)
+#undef EVENT_BUS_STORAGE
+
+//! \brief Name, storage, depth and payload size of every channel
+#define EVENT_BUS_DESCRIPTION(name, type, depth)                                                                       \
+	[EVENT_CHANNEL_##name] = {#name, g_##name##Storage, depth, sizeof(type)},
+static const ChannelDescription_t g_channels[EVENT_CHANNEL_AMOUNT] = {EVENT_BUS_CHANNELS(EVENT_BUS_DESCRIPTION)};
+#undef EVENT_BUS_DESCRIPTION
+
+//! \brief The queue control blocks, nothing of the bus is allocated from the heap
+static StaticQueue_t g_queueBuffers[EVENT_CHANNEL_AMOUNT];
+
+//! \brief The queues of the channels, NULL until eventBusInit() created them
+static QueueHandle_t g_queues[EVENT_CHANNEL_AMOUNT] = {NULL};
+
+//! \brief The counters of every channel
+static EventBusStatistics_t g_statistics[EVENT_CHANNEL_AMOUNT];
+
+//! \brief Spinlock protecting the counters, events are published from several tasks
+static portMUX_TYPE g_statisticsLock = portMUX_INITIALIZER_UNLOCKED;
+
+/*
+ *	Private functions
+ */
+//! \brief Raises the high-water mark of a channel. Has to be called with the statistics lock held
+//! \param channel The channel
+//! \param waiting Amount of events waiting in the channel, events which arrived while it was sampled can push it over
+//! the depth
+static void updateHighWater(const EventChannel_t channel, const UBaseType_t waiting)
+{
+	const uint16_t clamped = waiting > g_statistics[channel].depth ? g_statistics[channel].depth : (uint16_t)waiting;
+	if (clamped > g_statistics[channel].highWater) {
+		g_statistics[channel].highWater = clamped;
+	}
+}
+
+/*
+ *	Public function implementations
+ */
+bool eventBusInit()
+{
+	for (uint8_t channel = 0; channel < EVENT_CHANNEL_AMOUNT; channel++) {
+		const ChannelDescription_t* p_channel = &g_channels[channel];
+		g_queues[channel] = xQueueCreateStatic(p_channel->depth, p_channel->payloadSizeB, p_channel->p_storage,
+											   &g_queueBuffers[channel]);
+		if (g_queues[channel] == NULL) {
+			ESP_LOGE("EventBus", "Couldn't create the %s channel", p_channel->p_name);
+
+			return false;
+		}
+
+		g_statistics[channel].depth = p_channel->depth;
+	}
+
+	// Logging
+	ESP_LOGI("EventBus", "Created %d channels", EVENT_CHANNEL_AMOUNT);
+
+	return true;
+}
+
+bool eventBusPublishUnchecked(const EventChannel_t channel, const void* p_event, const TickType_t timeout)
+{
+	if (channel >= EVENT_CHANNEL_AMOUNT || g_queues[channel] == NULL || p_event == NULL) {
+		ESP_LOGE("EventBus", "Can't publish to channel %d", channel);
+
+		return false;
+	}
+
+	const bool published = xQueueSend(g_queues[channel], p_event, timeout) == pdPASS;
+	const UBaseType_t waiting = uxQueueMessagesWaiting(g_queues[channel]);
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	if (published) {
+		g_statistics[channel].published++;
+	}
+	else {
+		g_statistics[channel].overflows++;
+	}
+	updateHighWater(channel, waiting);
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	return published;
+}
+
+bool eventBusReceiveUnchecked(const EventChannel_t channel, void* p_event, const TickType_t timeout)
+{
+	if (channel >= EVENT_CHANNEL_AMOUNT || g_queues[channel] == NULL || p_event == NULL) {
+		ESP_LOGE("EventBus", "Can't receive from channel %d", channel);
+
+		return false;
+	}
+
+	if (xQueueReceive(g_queues[channel], p_event, timeout) != pdPASS) {
+		return false;
+	}
+
+	// Sampled here as well, so the mark also covers producers outside of the bus. The received event was waiting too
+	const UBaseType_t waiting = uxQueueMessagesWaiting(g_queues[channel]) + 1;
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	updateHighWater(channel, waiting);
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	return true;
+}
+
+QueueHandle_t* eventBusGetQueue(const EventChannel_t channel)
+{
+	if (channel >= EVENT_CHANNEL_AMOUNT) {
+		return NULL;
+	}
+
+	return &g_queues[channel];
+}
+
+void eventBusGetStatistics(const EventChannel_t channel, EventBusStatistics_t* p_statistics)
+{
+	if (p_statistics == NULL) {
+		return;
+	}
+
+	if (channel >= EVENT_CHANNEL_AMOUNT) {
+		memset(p_statistics, 0, sizeof(EventBusStatistics_t));
+		return;
+	}
+
+	// Sampled here as well, so a channel whose consumer stalled shows its backlog before the consumer catches up
+	const UBaseType_t waiting = g_queues[channel] != NULL ? uxQueueMessagesWaiting(g_queues[channel]) : 0;
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	updateHighWater(channel, waiting);
+	*p_statistics = g_statistics[channel];
+	taskEXIT_CRITICAL(&g_statisticsLock);
+}
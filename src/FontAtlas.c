@@ -0,0 +1,69 @@
+#include "FontAtlas.h"
+
+/*
+ *	Prototypes
+ */
+//! \brief Looks up the glyph id of a character
+//! \param p_atlas The font
+//! \param letter The code point
+//! \retval The glyph id, 0 if the font doesn't have it
+static uint16_t findGlyph(const FontAtlas_t* p_atlas, uint32_t letter);
+
+/*
+ *	Private function implementations
+ */
+static uint16_t findGlyph(const FontAtlas_t* p_atlas, const uint32_t letter)
+{
+	// Digits don't search at all. The E1234 digits are pre-rendered by LvglDigitDisplay, so this serves the numeric
+	// VCR_OSD_MONO labels like the fuel level
+	if (letter - '0' < 10 && p_atlas->firstDigitGlyph != 0) {
+		return p_atlas->firstDigitGlyph + (letter - '0');
+	}
+
+	uint16_t low = 0;
+	uint16_t high = p_atlas->otherGlyphAmount;
+	while (low < high) {
+		const uint16_t middle = low + (high - low) / 2;
+		const uint32_t codePoint = p_atlas->p_otherGlyphs[middle].codePoint;
+		if (codePoint == letter) {
+			return p_atlas->p_otherGlyphs[middle].glyphId;
+		}
+
+		if (codePoint < letter) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ *	Public function implementations
+ */
+bool fontAtlasGetGlyphDsc(const lv_font_t* p_font, lv_font_glyph_dsc_t* p_glyph, const uint32_t letter,
+						  const uint32_t nextLetter)
+{
+	(void)nextLetter;
+
+	const FontAtlas_t* p_atlas = p_font->dsc;
+	const uint16_t glyphId = findGlyph(p_atlas, letter);
+	if (glyphId == 0) {
+		return false;
+	}
+
+	// Same values lv_font_get_glyph_dsc_fmt_txt() fills in, the advance is stored in 1/16 px
+	const lv_font_fmt_txt_glyph_dsc_t* p_description = &p_atlas->base.glyph_dsc[glyphId];
+	p_glyph->adv_w = (p_description->adv_w + (1 << 3)) >> 4;
+	p_glyph->box_w = p_description->box_w;
+	p_glyph->box_h = p_description->box_h;
+	p_glyph->ofs_x = p_description->ofs_x;
+	p_glyph->ofs_y = p_description->ofs_y;
+	p_glyph->format = (lv_font_glyph_format_t)p_atlas->base.bpp;
+	p_glyph->is_placeholder = false;
+	p_glyph->gid.index = glyphId;
+
+	return true;
+}
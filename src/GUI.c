@@ -1,21 +1,29 @@
 #include "GUI.h"
 
 // Project includes
-#include "EventQueues.h"
+#include "AssetResidency.h"
+#include "EventBus.h"
+#include "GuiSensorData.h"
+#include "GuiStatistics.h"
+#include "LcdTransport.h"
+#include "LvglHeap.h"
+#include "Rgb565Swap.h"
+#include "RoundMask.h"
+#include "SensorSnapshot.h"
+#include "TaskTopology.h"
 #include "Screens/LvglRpmScreen.h"
 #include "Screens/LvglSpeedScreen.h"
 #include "Screens/LvglTemperatureScreen.h"
 
 // espidf includes
 #include <driver/gpio.h>
-#include <driver/spi_common.h>
 #include <esp_lcd_gc9a01.h>
-#include <esp_lcd_io_spi.h>
 #include <esp_lcd_panel_dev.h>
 #include <esp_lcd_panel_interface.h>
 #include <esp_lcd_panel_ops.h>
 #include <esp_lcd_types.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 
 // LVGL includes
 #include "lvgl.h"
@@ -23,47 +31,106 @@
 /*
  *	Private defines
  */
-#define LCD_SPI_HOST SPI2_HOST
-#define SPI_SPEED 10000000
-
 #define LCD_RESOLUTION 240
 #define LCD_BIT_DEPTH 16
 #define LCD_BYTE_DEPTH (LCD_BIT_DEPTH / 8)
 #define FRAME_BUFFER_SIZE_B (LCD_RESOLUTION * LCD_RESOLUTION * LCD_BYTE_DEPTH)
 #define DELAY_BETWEEN_DRAWING_MS 1
 
-#define GPIO_LCD_CS GPIO_NUM_33
-#define GPIO_LCD_CLK GPIO_NUM_34
-#define GPIO_LCD_DIN GPIO_NUM_35
+// Upper bound for the sleep of the LVGL task, so it still wakes up if LVGL has no timer pending
+#define LVGL_MAX_SLEEP_MS 500
+
+// The screens are resident, so switching must not grow the LVGL heap. Label texts are reallocated with every value
+// change, so a little jitter is expected
+#define SCREEN_SWITCH_HEAP_TOLERANCE_B 512
+
 #define GPIO_LCD_RST GPIO_NUM_36
-#define GPIO_LCD_DC GPIO_NUM_21
+
+// The GC9A01 expects RGB565 with the high byte first. LVGL 9.2 can't render that byte order, so every sent window is
+// swapped with the PIE kernel of Rgb565Swap.c before it is queued
+#define LCD_COLOR_FORMAT LV_COLOR_FORMAT_RGB565
+
+// The GC9A01 panel is round, nothing outside of the inscribed circle is visible
+#define LCD_IS_ROUND 1
 
 /*
  *	Private typedefs
  */
-typedef void (*EventHandlerFunction_t)(const QueueEvent_t* p_queueEvent);
+typedef void (*EventHandlerFunction_t)(const GuiEvent_t* p_event);
 
 /*
  *	Prototypes
  */
 static void flushPixelsToDisplay(lv_display_t* p_display, const lv_area_t* p_area, uint8_t* p_pxMap);
 
+//! \brief Blocks LVGL until the DMA transfer of the last flushed area finished
+//! \param p_display The display LVGL is waiting for
+static void waitForFlushToFinish(lv_display_t* p_display);
+
+//! \brief Called from the ISR of the transport once the color data of a flush left the SPI bus
+//! \retval Bool indicating if a higher priority task was woken
+static bool IRAM_ATTR onColorTransferDone();
+
+//! \brief Latches the flush statistics of the frame that was just refreshed
+//! \param p_event The LVGL event
+static void onFrameRefreshed(lv_event_t* p_event);
+
+//! \brief Clips every invalidated area to the visible part of the round panel, before LVGL renders it
+//! \param p_event The LVGL event
+static void onAreaInvalidated(lv_event_t* p_event);
+
 //! \brief Task which is needed for lvgl to work
 //! \param p_params void* needed for FreeRTOS to accept this function as task!
 static void IRAM_ATTR lvglUpdateTask(void* p_params);
 
-static void handleNewSensorData(const QueueEvent_t* p_queueEvent);
+//! \brief Tick source of LVGL
+//! \retval Milliseconds since boot
+static uint32_t getLvglTickMs();
+
+//! \brief Wakes up the LVGL task, so new data is rendered without waiting for its next timer
+static void wakeLvglTask();
+
+//! \brief Builds all screens once, they stay resident and are only swapped afterwards
+//! \retval Bool indicating if all screens were built
+static bool createScreens();
+
+//! \brief Samples the LVGL heap use and warns if it grew since the screens were built
+static void checkLvglHeap();
+
 
 /*
  *	Private variables
  */
 static bool g_refresh = true;
 
-static esp_lcd_panel_io_handle_t g_lcdPanelIoHandle = NULL;
+static TaskHandle_t g_lvglTaskHandle = NULL;
+
 static esp_lcd_panel_handle_t g_lcdPanelHandle = NULL;
 
+//! \brief Guards every LVGL call of our tasks. lv_timer_handler() takes the lock of the LVGL OS layer as well, always
+//! inside of this one, and the draw threads only work on the draw tasks it hands out, so the two can't deadlock
 static SemaphoreHandle_t g_lvglGuiSemaphore = NULL;
 static SemaphoreHandle_t g_lvglDrawSemaphore = NULL;
+static SemaphoreHandle_t g_flushDoneSemaphore = NULL;
+
+//! \brief Bool indicating if a flush is currently transferred via DMA
+static volatile bool g_flushInFlight = false;
+
+//! \brief Timestamp in us at which the current DMA transfer was started
+static int64_t g_flushStartUs = 0;
+
+//! \brief Amount of windows of the current flush which didn't leave the SPI bus yet
+static uint8_t g_flushWindowsInFlight = 0;
+
+//! \brief Accumulated DMA transfer and render stall time of the current frame
+static uint32_t g_frameTransferUs = 0;
+static uint32_t g_frameStallUs = 0;
+
+//! \brief Flush statistics of the last completely refreshed frame
+static GuiFlushStatistics_t g_lastFrameFlushStatistics = {0};
+
+//! \brief Spinlock protecting the flush statistics, as they are shared with the ISR
+static portMUX_TYPE g_flushStatisticsLock = portMUX_INITIALIZER_UNLOCKED;
 
 static lv_display_t* g_lvglDisplay = NULL;
 static uint16_t* g_lvglFrameBuffer1 = NULL;
@@ -72,21 +139,82 @@ static uint16_t* g_lvglFrameBuffer2 = NULL;
 static bool g_lvglFirstFrameDrawn = false;
 static Screen_t g_currentScreen = SCREEN_UNKNOWN;
 
+//! \brief Start of the running screen switch in us, 0 if none is running
+static volatile int64_t g_screenSwitchStartUs = 0;
+
+//! \brief The screen which was active before the running switch
+static lv_obj_t* volatile g_screenBeforeSwitch = NULL;
+
+//! \brief LVGL heap use in bytes right after all screens were built
+static uint32_t g_lvglHeapBaselineB = 0;
+
 /*
  *	ISRs and Tasks
  */
 static void flushPixelsToDisplay(lv_display_t* p_display, const lv_area_t* p_area, uint8_t* p_pxMap)
 {
-	// Swap the color channels as needed
-	lv_draw_sw_rgb565_swap(p_pxMap, (p_area->x2 + 1 - p_area->x1) * (p_area->y2 + 1 - p_area->y1)); // NOLINT
-
-	// Then draw the bitmap to the physical display (+1 needed, otherwise the image is distorted)
-	if (xSemaphoreTake(g_lvglDrawSemaphore, portMAX_DELAY) == pdTRUE) {
-		esp_lcd_panel_draw_bitmap(g_lcdPanelHandle, p_area->x1, p_area->y1, p_area->x2 + 1, p_area->y2 + 1, // NOLINT
-								  p_pxMap); // NOLINT
-		// vTaskDelay(pdMS_TO_TICKS(DELAY_BETWEEN_DRAWING_MS));
+	const int64_t flushStartUs = esp_timer_get_time();
+	uint32_t queuedBytes = 0;
+
+	// Only the visible pixels are sent. Without a mask the whole area is one window
+	RoundMaskWindow_t windows[ROUND_MASK_MAX_WINDOWS];
+	const uint8_t windowAmount = roundMaskSplit(p_area, p_pxMap, LCD_BYTE_DEPTH, windows);
+	uint32_t sentBytes = 0;
+	for (uint8_t i = 0; i < windowAmount; i++) {
+		sentBytes += windows[i].sizeB;
+
+		// The windows are packed, so only the pixels which are sent have to be swapped
+		rgb565Swap((uint16_t*)(p_pxMap + windows[i].offsetB), windows[i].sizeB / LCD_BYTE_DEPTH); // NOLINT
+	}
+	const uint32_t savedBytes = lv_area_get_size(p_area) * LCD_BYTE_DEPTH - sentBytes;
+
+	// Then queue the windows for the physical display (+1 needed, otherwise the image is distorted). esp_lcd sends the
+	// column and row window of a bitmap only after the transactions on the bus are done, so this blocks until every
+	// window but the last one is sent. The largest window goes last, it is the one overlapping with the rendering.
+	// LVGL is told that the buffer is free again once the last window left the bus
+	uint8_t largestWindow = 0;
+	for (uint8_t i = 1; i < windowAmount; i++) {
+		if (windows[i].sizeB > windows[largestWindow].sizeB) {
+			largestWindow = i;
+		}
+	}
+
+	if (windowAmount > 0 && xSemaphoreTake(g_lvglDrawSemaphore, portMAX_DELAY) == pdTRUE) {
+		g_flushStartUs = esp_timer_get_time();
+		taskENTER_CRITICAL(&g_flushStatisticsLock);
+		g_flushWindowsInFlight = windowAmount;
+		taskEXIT_CRITICAL(&g_flushStatisticsLock);
+		g_flushInFlight = true;
+
+		for (uint8_t n = 0; n < windowAmount; n++) {
+			const uint8_t i = n == windowAmount - 1 ? largestWindow : (n < largestWindow ? n : n + 1);
+			const lv_area_t* p_window = &windows[i].area;
+			if (lcdTransportDrawBitmap(g_lcdPanelHandle, p_window->x1, p_window->y1, p_window->x2 + 1, // NOLINT
+									   p_window->y2 + 1, p_pxMap + windows[i].offsetB, windows[i].sizeB) == ESP_OK) {
+				queuedBytes += windows[i].sizeB;
+				continue;
+			}
+
+			// Nothing was queued for this window, so no transfer done callback will follow for it
+			taskENTER_CRITICAL(&g_flushStatisticsLock);
+			const bool lastWindow = --g_flushWindowsInFlight == 0;
+			taskEXIT_CRITICAL(&g_flushStatisticsLock);
+			if (lastWindow) {
+				g_flushInFlight = false;
+				lv_display_flush_ready(p_display);
+			}
+		}
+
+		// Queuing blocked while the earlier windows were sent, the rendering couldn't overlap with that either
+		taskENTER_CRITICAL(&g_flushStatisticsLock);
+		g_frameStallUs += (uint32_t)(esp_timer_get_time() - g_flushStartUs);
+		taskEXIT_CRITICAL(&g_flushStatisticsLock);
+
 		xSemaphoreGive(g_lvglDrawSemaphore);
 	}
+	else {
+		lv_display_flush_ready(p_display);
+	}
 
 	// Turn the lcd panel on if it's the first image drawn
 	if (!g_lvglFirstFrameDrawn) {
@@ -97,37 +225,142 @@ static void flushPixelsToDisplay(lv_display_t* p_display, const lv_area_t* p_are
 		}
 	}
 
+	guiStatisticsRecordFlush((uint32_t)(esp_timer_get_time() - flushStartUs), queuedBytes, savedBytes);
+}
+
+static void waitForFlushToFinish(lv_display_t* p_display)
+{
+	const int64_t waitStartUs = esp_timer_get_time();
+
+	// Sleep until the ISR signals the end of the transfer instead of letting LVGL busy wait
+	while (g_flushInFlight) {
+		xSemaphoreTake(g_flushDoneSemaphore, pdMS_TO_TICKS(100));
+	}
+
+	// Everything we waited here is time the rendering could not overlap with the transfer
+	taskENTER_CRITICAL(&g_flushStatisticsLock);
+	g_frameStallUs += (uint32_t)(esp_timer_get_time() - waitStartUs);
+	taskEXIT_CRITICAL(&g_flushStatisticsLock);
+}
+
+static bool onColorTransferDone()
+{
+	BaseType_t higherPriorityTaskWoken = pdFALSE;
+
+	// Only flushes of LVGL are of interest
+	if (!g_flushInFlight) {
+		return false;
+	}
+
+	// The buffer is only free once every window of the flush was sent
+	taskENTER_CRITICAL_ISR(&g_flushStatisticsLock);
+	const bool lastWindow = --g_flushWindowsInFlight == 0;
+	if (lastWindow) {
+		g_frameTransferUs += (uint32_t)(esp_timer_get_time() - g_flushStartUs);
+	}
+	taskEXIT_CRITICAL_ISR(&g_flushStatisticsLock);
+
+	if (!lastWindow) {
+		return false;
+	}
+
+	// The buffer is free again, LVGL can render into it
+	g_flushInFlight = false;
 	lv_display_flush_ready(g_lvglDisplay);
+
+	// Wake up LVGL if it is already waiting for this buffer
+	xSemaphoreGiveFromISR(g_flushDoneSemaphore, &higherPriorityTaskWoken);
+
+	return higherPriorityTaskWoken == pdTRUE;
+}
+
+static void onAreaInvalidated(lv_event_t* p_event)
+{
+	roundMaskClipArea(lv_event_get_param(p_event));
+}
+
+static void onFrameRefreshed(lv_event_t* p_event)
+{
+	taskENTER_CRITICAL(&g_flushStatisticsLock);
+
+	// Whatever part of the transfer time we did not stall was spent rendering in parallel
+	const uint32_t overlapUs = g_frameTransferUs > g_frameStallUs ? g_frameTransferUs - g_frameStallUs : 0;
+
+	g_lastFrameFlushStatistics.transferUs = g_frameTransferUs;
+	g_lastFrameFlushStatistics.stallUs = g_frameStallUs;
+	g_lastFrameFlushStatistics.overlapUs = overlapUs;
+	g_lastFrameFlushStatistics.overlapPercent =
+		g_frameTransferUs == 0 ? 0 : (uint8_t)((uint64_t)overlapUs * 100 / g_frameTransferUs);
+
+	// Start the next frame
+	g_frameTransferUs = 0;
+	g_frameStallUs = 0;
+
+	taskEXIT_CRITICAL(&g_flushStatisticsLock);
+
+	guiStatisticsRecordFrame();
+
+	// The first frame showing the new screen ends the switch
+	if (g_screenSwitchStartUs != 0 && lv_display_get_screen_active(g_lvglDisplay) != g_screenBeforeSwitch) {
+		guiStatisticsRecordScreenSwitch((uint32_t)(esp_timer_get_time() - g_screenSwitchStartUs));
+		g_screenSwitchStartUs = 0;
+	}
 }
 
 static void lvglUpdateTask(void* p_params)
 {
+	SensorSnapshot_t snapshot;
 	while (true) {
+		uint32_t timeUntilNextRunMs = LVGL_MAX_SLEEP_MS;
+
+		// Sample the latest sensor data once per frame. Everything received in between was dropped already. The
+		// bindings also apply rate limited values which became due in the meantime and step interpolated ones
+		if (g_refresh) {
+			const bool newData = sensorSnapshotConsume(&snapshot);
+			const uint32_t bindingsDueMs =
+				guiHandleNewSensorData(g_currentScreen, newData ? &snapshot : NULL, &g_lvglGuiSemaphore);
+			if (bindingsDueMs < timeUntilNextRunMs) {
+				timeUntilNextRunMs = bindingsDueMs;
+			}
+		}
+
 		// Try to get the semaphore
 		if (xSemaphoreTake(g_lvglGuiSemaphore, portMAX_DELAY) == pdTRUE) {
-			// Run the lvgl task handler
-			lv_timer_handler();
+			// Run the lvgl task handler, it tells us when it needs to run again
+			const int64_t timerHandlerStartUs = esp_timer_get_time();
+			const uint32_t lvglDueMs = lv_timer_handler();
+			guiStatisticsRecordTimerHandler((uint32_t)(esp_timer_get_time() - timerHandlerStartUs));
+			if (lvglDueMs < timeUntilNextRunMs) {
+				timeUntilNextRunMs = lvglDueMs;
+			}
 
 			// Give the semaphore free
 			xSemaphoreGive(g_lvglGuiSemaphore);
+		}
 
-			// Wait 10ms
-			vTaskDelay(pdMS_TO_TICKS(10));
+		// Also covers LV_NO_TIMER_READY
+		if (timeUntilNextRunMs > LVGL_MAX_SLEEP_MS) {
+			timeUntilNextRunMs = LVGL_MAX_SLEEP_MS;
 		}
+
+		// Sleep until LVGL needs to run again (rounded up to full ticks) or until new data arrives. The notification
+		// slot is only ours, CONFIG_LV_USE_FREERTOS_TASK_NOTIFY is off so LVGL waits for its draw threads on semaphores
+		const TickType_t sleepTicks = (timeUntilNextRunMs + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+		ulTaskNotifyTake(pdTRUE, sleepTicks);
 	}
 }
 
-static void guiEventQueueTask()
+static void guiEventQueueTask(void* p_params)
 {
-	QueueEvent_t queueEvent;
+	GuiEvent_t event;
 	while (true) {
 		// Wait until we get a new event
-		if (xQueueReceive(g_guiEventQueue, &queueEvent, portMAX_DELAY)) {
+		if (EVENT_BUS_RECEIVE(GUI, &event, portMAX_DELAY)) {
 			if (!g_refresh) {
 				continue;
 			}
 
-			switch (queueEvent.command) {
+			switch (event.command) {
 				case DISPLAY_TEMPERATURE_SCREEN:
 					{
 						guiDisplayScreen(SCREEN_TEMPERATURE);
@@ -143,9 +376,6 @@ static void guiEventQueueTask()
 						guiDisplayScreen(SCREEN_RPM);
 						break;
 					}
-				case NEW_SENSOR_DATA:
-					handleNewSensorData(&queueEvent);
-					break;
 				default:
 					break;
 			}
@@ -158,20 +388,9 @@ static void guiEventQueueTask()
  */
 static bool initDisplay()
 {
-	// Create the SPI config for the LCD
-	const esp_lcd_panel_io_spi_config_t lcdPanelIoConfig = {
-		.dc_gpio_num = GPIO_LCD_DC,
-		.cs_gpio_num = GPIO_LCD_CS,
-		.pclk_hz = SPI_SPEED,
-		.lcd_cmd_bits = 8,
-		.lcd_param_bits = 8,
-		.spi_mode = 0,
-		.trans_queue_depth = 10,
-	};
-
-	// Initialize the LCD
-	if (esp_lcd_new_panel_io_spi(LCD_SPI_HOST, &lcdPanelIoConfig, &g_lcdPanelIoHandle) != ESP_OK) {
-		ESP_LOGE("GUI", "Failed to initialize LCD panel");
+	// Initialize the SPI transport, a full screen flush has to fit into its queue
+	if (!lcdTransportInit(FRAME_BUFFER_SIZE_B, onColorTransferDone)) {
+		ESP_LOGE("GUI", "Failed to initialize the SPI transport");
 
 		return false;
 	}
@@ -184,7 +403,7 @@ static bool initDisplay()
 	};
 
 	// Create a new GC9A01 panel
-	if (esp_lcd_new_panel_gc9a01(g_lcdPanelIoHandle, &lcdPanelDevConfig, &g_lcdPanelHandle) != ESP_OK) {
+	if (esp_lcd_new_panel_gc9a01(lcdTransportGetPanelIo(), &lcdPanelDevConfig, &g_lcdPanelHandle) != ESP_OK) {
 		ESP_LOGE("GUI", "Couldn't create GC9A01 panel");
 		return false;
 	}
@@ -228,9 +447,19 @@ static bool initLvgl()
 	// Create the needed semaphores
 	g_lvglGuiSemaphore = xSemaphoreCreateMutex();
 	g_lvglDrawSemaphore = xSemaphoreCreateMutex();
+	g_flushDoneSemaphore = xSemaphoreCreateBinary();
 
-	// Call the lvgl init function
+	// Call the lvgl init function. It creates one draw thread per draw unit, the task table ranks them against the CAN
+	// tasks
+	const uint32_t taskMark = taskTopologyGetCreationMark();
 	lv_init();
+#if LV_USE_OS != LV_OS_NONE
+	if (taskTopologyAdopt(TASK_LVGL_DRAW_0, LV_DRAW_SW_DRAW_UNIT_CNT, taskMark) != LV_DRAW_SW_DRAW_UNIT_CNT) {
+		ESP_LOGW("GUI", "Couldn't adopt the %d draw threads of LVGL", LV_DRAW_SW_DRAW_UNIT_CNT);
+	}
+#else
+	(void)taskMark;
+#endif
 
 	// Create the display
 	g_lvglDisplay = lv_display_create(LCD_RESOLUTION, LCD_RESOLUTION);
@@ -253,8 +482,9 @@ static bool initLvgl()
 	lv_display_set_buffers(g_lvglDisplay, g_lvglFrameBuffer1, g_lvglFrameBuffer2, FRAME_BUFFER_SIZE_B,
 						   LV_DISPLAY_RENDER_MODE_PARTIAL);
 
-	// Set the color formats
-	lv_display_set_color_format(g_lvglDisplay, LV_COLOR_FORMAT_RGB565);
+	// Set the color formats. The flush callback swaps the bytes into the order of the panel
+	lv_display_set_color_format(g_lvglDisplay, LCD_COLOR_FORMAT);
+	rgb565SwapInit();
 
 	// Set the background for the active screen
 	lv_obj_set_style_bg_color(lv_display_get_screen_active(g_lvglDisplay), lv_color_hex(0x000000), LV_PART_MAIN);
@@ -262,10 +492,27 @@ static bool initLvgl()
 	// Set the callback function, to draw to the physical displays
 	lv_display_set_flush_cb(g_lvglDisplay, flushPixelsToDisplay);
 
+	// Let LVGL sleep while a DMA transfer is running, instead of spinning
+	lv_display_set_flush_wait_cb(g_lvglDisplay, waitForFlushToFinish);
+
+	// Collect the flush statistics after every frame
+	lv_display_add_event_cb(g_lvglDisplay, onFrameRefreshed, LV_EVENT_REFR_READY, NULL);
+
+#if LCD_IS_ROUND
+	// Neither render nor send the corners of the panel
+	if (roundMaskInit(LCD_RESOLUTION)) {
+		lv_display_add_event_cb(g_lvglDisplay, onAreaInvalidated, LV_EVENT_INVALIDATE_AREA, NULL);
+	}
+	else {
+		ESP_LOGW("GUI", "Round mask doesn't support a diameter of %d, the whole panel is flushed", LCD_RESOLUTION);
+	}
+#endif
+
 	// Set tick interface for animations etc.
-	lv_tick_set_cb(xTaskGetTickCount);
+	lv_tick_set_cb(getLvglTickMs);
 
-	if (xTaskCreate(lvglUpdateTask, "lvglUpdateTask", 10000, NULL, 0, NULL) != pdPASS) {
+	// Runs alone on the render core, see TaskTopology.c
+	if (!taskTopologyCreate(TASK_LVGL, lvglUpdateTask, NULL, &g_lvglTaskHandle)) {
 		// Logging
 		ESP_LOGE("GUI", "Failed to create task: \"lvglUpdateTask\"!");
 
@@ -276,58 +523,47 @@ static bool initLvgl()
 	return true;
 }
 
-static void handleNewSensorData(const QueueEvent_t* p_queueEvent)
+static uint32_t getLvglTickMs()
 {
-	if (g_currentScreen == SCREEN_UNKNOWN) {
-		return;
+	// Independent of the FreeRTOS tick rate, which is configurable in sdkconfig
+	return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static void wakeLvglTask()
+{
+	if (g_lvglTaskHandle != NULL) {
+		xTaskNotifyGive(g_lvglTaskHandle);
 	}
+}
 
-	// Get the oil pressure
-	const bool oilPressure = p_queueEvent->frameBuffer[5];
+static bool createScreens()
+{
+	if (!guiCreateTemperatureScreen(&g_lvglGuiSemaphore) || !guiCreateSpeedScreen(&g_lvglGuiSemaphore) ||
+		!guiCreateRpmScreen(&g_lvglGuiSemaphore)) {
+		return false;
+	}
 
-	// Act depending on the current screen
-	switch (g_currentScreen) {
-		case SCREEN_TEMPERATURE:
-			{
-				// Set the temperature
-				const uint8_t waterTemp = p_queueEvent->frameBuffer[4];
-				guiSetWaterTemp(waterTemp, &g_lvglGuiSemaphore);
+	// Everything allocated from now on would be a leak of the screen switching
+	LvglHeapStatistics_t heapStatistics;
+	lvglHeapGetStatistics(&heapStatistics);
+	g_lvglHeapBaselineB = heapStatistics.internalUsedB + heapStatistics.overflowUsedB;
 
-				// Set the fuel level in %
-				const uint8_t fuelLevel = p_queueEvent->frameBuffer[3];
-				guiSetFuelLevel(fuelLevel, &g_lvglGuiSemaphore);
+	ESP_LOGI("GUI", "All screens built, LVGL heap use: %lu of %lu bytes internal, %lu bytes in PSRAM",
+			 (unsigned long)heapStatistics.internalUsedB, (unsigned long)heapStatistics.internalSizeB,
+			 (unsigned long)heapStatistics.overflowUsedB);
 
-				break;
-			}
-		case SCREEN_SPEED:
-			{
-				// Set the speed
-				const uint8_t speedKmh = p_queueEvent->frameBuffer[0];
-				guiSetSpeed(speedKmh, &g_lvglGuiSemaphore);
+	return true;
+}
 
-				// Get the status of the right indicator
-				const bool indicatorActive = p_queueEvent->frameBuffer[7];
-				guiSetRightIndicatorActive((bool)indicatorActive, &g_lvglGuiSemaphore);
+static void checkLvglHeap()
+{
+	LvglHeapStatistics_t heapStatistics;
+	lvglHeapGetStatistics(&heapStatistics);
 
-				break;
-			}
-		case SCREEN_RPM:
-			{
-				// Set the rpm
-				const uint16_t lowerRpmByte = p_queueEvent->frameBuffer[2];
-				const uint16_t upperRpmByte = p_queueEvent->frameBuffer[1] << 8;
-				const uint16_t rpm = lowerRpmByte + upperRpmByte;
-				guiSetRpm(rpm, &g_lvglGuiSemaphore);
-
-				// Get the status of the left indicator
-				const bool indicatorActive = p_queueEvent->frameBuffer[6];
-				guiSetLeftIndicatorActive((bool)indicatorActive, &g_lvglGuiSemaphore);
-
-				break;
-			}
-		default:
-			ESP_LOGE("GUI", "Currently displaying an invalid screen. Couldn't update data");
-			break;
+	const uint32_t usedB = heapStatistics.internalUsedB + heapStatistics.overflowUsedB;
+	if (usedB > g_lvglHeapBaselineB + SCREEN_SWITCH_HEAP_TOLERANCE_B) {
+		ESP_LOGW("GUI", "LVGL heap grew from %lu to %lu bytes across screen switches",
+				 (unsigned long)g_lvglHeapBaselineB, (unsigned long)usedB);
 	}
 }
 
@@ -336,22 +572,6 @@ static void handleNewSensorData(const QueueEvent_t* p_queueEvent)
  */
 bool guiInit()
 {
-	// Create SPI bus config
-	const spi_bus_config_t spiBusConfig = {.sclk_io_num = GPIO_LCD_CLK,
-										   .mosi_io_num = GPIO_LCD_DIN,
-										   .miso_io_num = -1,
-										   .quadwp_io_num = -1,
-										   .quadhd_io_num = -1,
-										   .max_transfer_sz = SOC_SPI_MAXIMUM_BUFFER_SIZE};
-
-	// Initialize SPI bus
-	if (spi_bus_initialize(LCD_SPI_HOST, &spiBusConfig, SPI_DMA_CH_AUTO) != ESP_OK) {
-		// Logging
-		ESP_LOGE("GUI", "Failed to initialize SPI bus");
-
-		return false;
-	}
-
 	// Initialize the display
 	if (!initDisplay()) {
 		ESP_LOGE("GUI", "Failed to initialize display");
@@ -365,8 +585,15 @@ bool guiInit()
 		return false;
 	}
 
+	// Build every screen up front, so switching only has to load them
+	if (!createScreens()) {
+		ESP_LOGE("GUI", "Failed to create the screens");
+
+		return false;
+	}
+
 	// Start the task which will handle all the queue events
-	if (xTaskCreate(guiEventQueueTask, "handleGuiEventQueueTask", 16384 / 4, NULL, 2, NULL) != pdPASS) {
+	if (!taskTopologyCreate(TASK_GUI_EVENTS, guiEventQueueTask, NULL, NULL)) {
 		// Logging
 		ESP_LOGE("GUI", "Failed to create task: \"handleGuiEventQueueTask\"!");
 
@@ -376,6 +603,36 @@ bool guiInit()
 	return true;
 }
 
+void guiGetFlushStatistics(GuiFlushStatistics_t* p_statistics)
+{
+	if (p_statistics == NULL) {
+		return;
+	}
+
+	taskENTER_CRITICAL(&g_flushStatisticsLock);
+	*p_statistics = g_lastFrameFlushStatistics;
+	taskEXIT_CRITICAL(&g_flushStatisticsLock);
+}
+
+void guiSetAssetResidencyBudget(const uint32_t budgetB)
+{
+	if (xSemaphoreTake(g_lvglGuiSemaphore, portMAX_DELAY) == pdTRUE) {
+		assetResidencySetBudget(budgetB);
+		xSemaphoreGive(g_lvglGuiSemaphore);
+	}
+
+	// Render times measured from here on belong to the new budget
+	guiStatisticsResetDurations();
+
+	// Redraw with the new copies, so the next render times reflect them
+	wakeLvglTask();
+}
+
+void guiNotifyNewSensorData()
+{
+	wakeLvglTask();
+}
+
 void guiActivateRefreshing()
 {
 	g_refresh = true;
@@ -390,24 +647,50 @@ bool guiDisplayScreen(const Screen_t screen)
 {
 	ESP_LOGI("GUI", "Displaying screen: %d", screen);
 
-	// Destroy all screens if necessary
-	if (g_currentScreen != SCREEN_UNKNOWN) {
-		guiDestroyTemperatureScreen();
-		guiDestroySpeedScreen();
-		guiDestroyRpmScreen();
+	// Nothing to do if it is already shown
+	if (screen == g_currentScreen) {
+		return true;
 	}
 
-	// Create the screen and show it
-	g_currentScreen = screen;
+	// Remember what was shown, so the refresh callback can tell when the new screen reached the display
+	g_screenBeforeSwitch = lv_display_get_screen_active(g_lvglDisplay);
+	g_screenSwitchStartUs = esp_timer_get_time();
+
+	// Copy the assets of the new screen into internal RAM before its first frame is rendered
+	if (xSemaphoreTake(g_lvglGuiSemaphore, portMAX_DELAY) == pdTRUE) {
+		assetResidencyLoadScreen(screen);
+		xSemaphoreGive(g_lvglGuiSemaphore);
+	}
+
+	// All screens are resident, so this only swaps the active one
+	bool success = false;
 	switch (screen) {
 		case SCREEN_TEMPERATURE:
-			return guiCreateAndShowTemperatureScreen(&g_lvglGuiSemaphore);
+			success = guiShowTemperatureScreen(&g_lvglGuiSemaphore);
+			break;
 		case SCREEN_SPEED:
-			return guiCreateAndShowSpeedScreen(&g_lvglGuiSemaphore);
+			success = guiShowSpeedScreen(&g_lvglGuiSemaphore);
+			break;
 		case SCREEN_RPM:
-			return guiCreateAndShowRpmScreen(&g_lvglGuiSemaphore);
+			success = guiShowRpmScreen(&g_lvglGuiSemaphore);
+			break;
 		default:
 			ESP_LOGW("GUI", "Unknown screen: %d", screen);
-			return false;
+			break;
 	}
+
+	if (!success) {
+		g_screenSwitchStartUs = 0;
+		return false;
+	}
+
+	g_currentScreen = screen;
+
+	// Switching must not leak LVGL memory
+	checkLvglHeap();
+
+	// Render the new screen right away
+	wakeLvglTask();
+
+	return true;
 }
@@ -0,0 +1,288 @@
+#include "GuiBindings.h"
+
+// C includes
+#include <stdlib.h>
+
+// espidf includes
+#include <esp_timer.h>
+
+/*
+ *	Private defines
+ */
+//! \brief Interpolated values have 8 fraction bits
+#define INTERPOLATION_FRACTION_BITS 8
+
+//! \brief Values beyond this are shown as step, their difference wouldn't fit into the fixed point format
+#define INTERPOLATION_MAX_VALUE (1 << 21)
+
+//! \brief Gaps between two samples above this don't count into the sample period, the sender was just quiet
+#define SAMPLE_PERIOD_MAX_US 1000000
+
+/*
+ *	Private typedefs
+ */
+//! \brief The latest sample of a signal
+typedef struct
+{
+	//! \brief The decoded value
+	int32_t value;
+
+	//! \brief When the sample was received in us
+	int64_t receivedUs;
+
+	//! \brief Smoothed time between two samples in us, 0 while unknown
+	uint32_t periodUs;
+
+	//! \brief Bool indicating if the signal was received at all
+	bool valid;
+} SignalSample_t;
+
+//! \brief What the engine knows about the widget of one binding
+typedef struct
+{
+	//! \brief The value the widget currently shows
+	int32_t shownValue;
+
+	//! \brief The interpolated value and the animation towards the latest sample, in fixed point
+	int32_t currentQ8;
+	int32_t startQ8;
+	int32_t targetQ8;
+	int32_t stepQ8PerMs;
+
+	//! \brief Start and length of the animation, a length of 0 means it's finished
+	int64_t animationStartUs;
+	uint32_t animationMs;
+
+	//! \brief The sample the animation runs towards
+	int64_t sampleUs;
+
+	//! \brief Direction of the last change, -1, 0 or 1
+	int8_t lastDirection;
+
+	//! \brief When the widget was updated last in ms
+	int64_t lastUpdateMs;
+
+	//! \brief Bool indicating if the widget shows a value at all
+	bool shown;
+} BindingState_t;
+
+/*
+ *	Prototypes
+ */
+//! \brief Checks if a new value differs enough from the shown one
+//! \param p_binding The binding
+//! \param p_state The state of the binding
+//! \param value The new value
+//! \retval Bool indicating if the widget should show it
+static bool mattersVisually(const GuiBinding_t* p_binding, const BindingState_t* p_state, int32_t value);
+
+//! \brief Advances the animation of an interpolated binding
+//! \param p_binding The binding
+//! \param p_state The state of the binding
+//! \param p_sample The latest sample of the signal
+//! \param nowUs The current time in us
+//! \param p_value Where the value to show right now is written to
+//! \retval Bool indicating if the animation is still running
+static bool interpolate(const GuiBinding_t* p_binding, BindingState_t* p_state, const SignalSample_t* p_sample,
+						int64_t nowUs, int32_t* p_value);
+
+/*
+ *	Private variables
+ */
+//! \brief The latest sample of every signal, written and read by the LVGL task only
+static SignalSample_t g_samples[SENSOR_SIGNAL_AMOUNT] = {0};
+
+//! \brief The bindings the states belong to
+static const GuiBinding_t* g_activeBindings = NULL;
+static BindingState_t g_states[GUI_BINDINGS_MAX_PER_SCREEN];
+
+/*
+ *	Private function implementations
+ */
+static bool mattersVisually(const GuiBinding_t* p_binding, const BindingState_t* p_state, const int32_t value)
+{
+	const int32_t delta = value - p_state->shownValue;
+	if (delta == 0) {
+		return false;
+	}
+
+	// Turning around needs a bigger step, otherwise noise around a digit boundary would flicker
+	const int8_t direction = delta > 0 ? 1 : -1;
+	uint32_t requiredChange = p_binding->threshold;
+	if (p_state->lastDirection != 0 && direction != p_state->lastDirection) {
+		requiredChange += p_binding->hysteresis;
+	}
+
+	return (uint32_t)abs(delta) >= requiredChange;
+}
+
+static bool interpolate(const GuiBinding_t* p_binding, BindingState_t* p_state, const SignalSample_t* p_sample,
+						const int64_t nowUs, int32_t* p_value)
+{
+	// A new sample starts a new animation from wherever the widget is right now
+	if (p_sample->receivedUs != p_state->sampleUs) {
+		p_state->sampleUs = p_sample->receivedUs;
+
+		uint32_t durationMs = p_sample->periodUs / 1000;
+		if (durationMs > p_binding->lagBudgetMs) {
+			durationMs = p_binding->lagBudgetMs;
+		}
+
+		// Values which don't fit into the fixed point format are shown as step, the next animation starts at the
+		// closest one which fits
+		int32_t target = p_sample->value;
+		const bool inRange = target > -INTERPOLATION_MAX_VALUE && target < INTERPOLATION_MAX_VALUE;
+		if (!inRange) {
+			target = target < 0 ? -INTERPOLATION_MAX_VALUE + 1 : INTERPOLATION_MAX_VALUE - 1;
+		}
+		p_state->targetQ8 = target * (1 << INTERPOLATION_FRACTION_BITS);
+
+		if (!p_state->shown || durationMs == 0 || !inRange) {
+			// Nothing to animate from, show the sample right away
+			p_state->animationMs = 0;
+			p_state->currentQ8 = p_state->targetQ8;
+			*p_value = p_sample->value;
+			return false;
+		}
+
+		p_state->startQ8 = p_state->currentQ8;
+		p_state->stepQ8PerMs = (p_state->targetQ8 - p_state->startQ8) / (int32_t)durationMs;
+		p_state->animationStartUs = p_sample->receivedUs;
+		p_state->animationMs = durationMs;
+	}
+
+	if (p_state->animationMs > 0) {
+		const int64_t elapsedUs = nowUs - p_state->animationStartUs;
+		if (elapsedUs >= (int64_t)p_state->animationMs * 1000) {
+			p_state->animationMs = 0;
+			p_state->currentQ8 = p_state->targetQ8;
+		}
+		else if (elapsedUs > 0) {
+			// The step is rounded down, the last one snaps to the target
+			const int32_t elapsedMs = (int32_t)((uint32_t)elapsedUs / 1000);
+			p_state->currentQ8 = p_state->startQ8 + p_state->stepQ8PerMs * elapsedMs;
+		}
+	}
+
+	// Rounded to the nearest integer
+	*p_value = (p_state->currentQ8 + (1 << (INTERPOLATION_FRACTION_BITS - 1))) >> INTERPOLATION_FRACTION_BITS;
+	return p_state->animationMs > 0;
+}
+
+/*
+ *	Public function implementations
+ */
+void guiBindingsSetSignal(const SensorSignal_t signal, const int32_t value, const int64_t receivedUs)
+{
+	if (signal >= SENSOR_SIGNAL_AMOUNT) {
+		return;
+	}
+
+	SignalSample_t* p_sample = &g_samples[signal];
+
+	// Smoothed, so a single late frame doesn't stretch the next animation
+	if (p_sample->valid && receivedUs > p_sample->receivedUs) {
+		const int64_t periodUs = receivedUs - p_sample->receivedUs;
+		if (periodUs < SAMPLE_PERIOD_MAX_US) {
+			p_sample->periodUs =
+				p_sample->periodUs == 0 ? (uint32_t)periodUs : (3 * p_sample->periodUs + (uint32_t)periodUs) / 4;
+		}
+	}
+
+	p_sample->value = value;
+	p_sample->receivedUs = receivedUs;
+	p_sample->valid = true;
+}
+
+uint32_t guiBindingsApply(const GuiBinding_t* p_bindings, uint8_t amount, const SemaphoreHandle_t* p_guiSemaphore)
+{
+	if (p_bindings == NULL || amount == 0) {
+		g_activeBindings = NULL;
+		return GUI_BINDINGS_NOTHING_PENDING;
+	}
+
+	if (amount > GUI_BINDINGS_MAX_PER_SCREEN) {
+		amount = GUI_BINDINGS_MAX_PER_SCREEN;
+	}
+
+	// Another screen became active, its widgets show whatever they had when it was hidden
+	if (p_bindings != g_activeBindings) {
+		g_activeBindings = p_bindings;
+		for (uint8_t i = 0; i < amount; i++) {
+			g_states[i].shown = false;
+			g_states[i].lastDirection = 0;
+			g_states[i].animationMs = 0;
+			g_states[i].sampleUs = -1;
+		}
+	}
+
+	const int64_t nowUs = esp_timer_get_time();
+	const int64_t nowMs = nowUs / 1000;
+	uint32_t nextDueMs = GUI_BINDINGS_NOTHING_PENDING;
+
+	// Find the updates which are due, the semaphore is only taken if there is at least one
+	int32_t values[GUI_BINDINGS_MAX_PER_SCREEN];
+	bool due[GUI_BINDINGS_MAX_PER_SCREEN] = {false};
+	bool anyDue = false;
+	for (uint8_t i = 0; i < amount; i++) {
+		const GuiBinding_t* p_binding = &p_bindings[i];
+		BindingState_t* p_state = &g_states[i];
+		if (p_binding->signal >= SENSOR_SIGNAL_AMOUNT || !g_samples[p_binding->signal].valid) {
+			continue;
+		}
+
+		// Interpolated values need another step every frame until they reached the sample
+		const SignalSample_t* p_sample = &g_samples[p_binding->signal];
+		values[i] = p_sample->value;
+		if (p_binding->lagBudgetMs > 0 &&
+			interpolate(p_binding, p_state, p_sample, nowUs, &values[i]) &&
+			GUI_BINDINGS_ANIMATION_PERIOD_MS < nextDueMs) {
+			nextDueMs = GUI_BINDINGS_ANIMATION_PERIOD_MS;
+		}
+
+		// Skip everything that doesn't change what is visible
+		if (p_state->shown && !mattersVisually(p_binding, p_state, values[i])) {
+			continue;
+		}
+
+		// Rate limited, the latest value is applied once the interval elapsed
+		const int64_t elapsedMs = nowMs - p_state->lastUpdateMs;
+		if (p_state->shown && elapsedMs < p_binding->minIntervalMs) {
+			const uint32_t remainingMs = (uint32_t)(p_binding->minIntervalMs - elapsedMs);
+			if (remainingMs < nextDueMs) {
+				nextDueMs = remainingMs;
+			}
+			continue;
+		}
+
+		due[i] = true;
+		anyDue = true;
+	}
+
+	if (!anyDue) {
+		return nextDueMs;
+	}
+
+	// Apply all due updates at once
+	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
+		for (uint8_t i = 0; i < amount; i++) {
+			if (!due[i]) {
+				continue;
+			}
+
+			BindingState_t* p_state = &g_states[i];
+			p_bindings[i].setter(values[i]);
+
+			if (p_state->shown && values[i] != p_state->shownValue) {
+				p_state->lastDirection = values[i] > p_state->shownValue ? 1 : -1;
+			}
+			p_state->shownValue = values[i];
+			p_state->lastUpdateMs = nowMs;
+			p_state->shown = true;
+		}
+
+		xSemaphoreGive(*p_guiSemaphore);
+	}
+
+	return nextDueMs;
+}
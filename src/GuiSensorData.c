@@ -0,0 +1,68 @@
+#include "GuiSensorData.h"
+
+// Project includes
+#include "GuiBindings.h"
+#include "SensorSignals.h"
+#include "SignalDecoder.h"
+#include "Screens/LvglRpmScreen.h"
+#include "Screens/LvglSpeedScreen.h"
+#include "Screens/LvglTemperatureScreen.h"
+
+// espidf includes
+#include <esp_log.h>
+
+/*
+ *	Prototypes
+ */
+//! \brief Decodes the sensor data frame into signals with the tables generated from res/can/SensorData.dbc
+//! \param p_snapshot The latest sensor data
+static void decodeSensorData(const SensorSnapshot_t* p_snapshot);
+
+/*
+ *	Private function implementations
+ */
+static void decodeSensorData(const SensorSnapshot_t* p_snapshot)
+{
+	int32_t values[SENSOR_SIGNAL_AMOUNT];
+	uint32_t decoded = signalDecoderDecode(&g_sensorSignalDecodeTable, p_snapshot->buffer, p_snapshot->dlc, values);
+
+	// Signals which didn't fit into the dlc keep their previous value
+	for (uint8_t signal = 0; decoded != 0; signal++, decoded >>= 1) {
+		if (decoded & 1) {
+			guiBindingsSetSignal(signal, values[signal], p_snapshot->receivedUs);
+		}
+	}
+}
+
+/*
+ *	Public function implementations
+ */
+uint32_t guiHandleNewSensorData(const Screen_t screen, const SensorSnapshot_t* p_snapshot,
+								const SemaphoreHandle_t* p_guiSemaphore)
+{
+	if (p_snapshot != NULL) {
+		decodeSensorData(p_snapshot);
+	}
+
+	// Only the widgets of the active screen are updated
+	uint8_t amount = 0;
+	const GuiBinding_t* p_bindings = NULL;
+	switch (screen) {
+		case SCREEN_TEMPERATURE:
+			p_bindings = guiGetTemperatureScreenBindings(&amount);
+			break;
+		case SCREEN_SPEED:
+			p_bindings = guiGetSpeedScreenBindings(&amount);
+			break;
+		case SCREEN_RPM:
+			p_bindings = guiGetRpmScreenBindings(&amount);
+			break;
+		case SCREEN_UNKNOWN:
+			break;
+		default:
+			ESP_LOGE("GUI", "Currently displaying an invalid screen. Couldn't update data");
+			break;
+	}
+
+	return guiBindingsApply(p_bindings, amount, p_guiSemaphore);
+}
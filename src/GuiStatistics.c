@@ -0,0 +1,147 @@
+#include "GuiStatistics.h"
+
+// Project includes
+#include "SensorSnapshot.h"
+
+// C includes
+#include <string.h>
+
+// espidf includes
+#include <esp_timer.h>
+
+// FreeRTOS include
+#include "freertos/FreeRTOS.h"
+
+/*
+ *	Private defines
+ */
+//! \brief Length of the window the frames per second are averaged over
+#define FPS_WINDOW_US 1000000
+
+/*
+ *	Prototypes
+ */
+//! \brief Adds a sample to a histogram. Has to be called with the statistics lock held
+//! \param p_histogram The histogram
+//! \param durationUs The sample
+//! \param baseUs Upper bound of the first bucket
+static void addSample(GuiDurationHistogram_t* p_histogram, uint32_t durationUs, uint32_t baseUs);
+
+/*
+ *	Private variables
+ */
+//! \brief The statistics, only accessed with the lock held
+static GuiRenderStatistics_t g_statistics = {0};
+
+//! \brief Start of the current fps window in us and the frames refreshed within it
+static int64_t g_fpsWindowStartUs = 0;
+static uint32_t g_fpsWindowFrames = 0;
+
+//! \brief Bytes saved by the flushes of the frame which is currently refreshed
+static uint32_t g_frameSpiBytesSaved = 0;
+
+//! \brief Spinlock protecting the statistics. The critical sections only copy a few words, so recording stays cheap
+static portMUX_TYPE g_statisticsLock = portMUX_INITIALIZER_UNLOCKED;
+
+/*
+ *	Private function implementations
+ */
+static void addSample(GuiDurationHistogram_t* p_histogram, const uint32_t durationUs, const uint32_t baseUs)
+{
+	// Find the first bucket whose upper bound is above the sample
+	uint8_t bucket = 0;
+	uint32_t upperBoundUs = baseUs;
+	while (bucket < GUI_HISTOGRAM_BUCKETS - 1 && durationUs >= upperBoundUs) {
+		bucket++;
+		upperBoundUs *= 2;
+	}
+
+	p_histogram->buckets[bucket]++;
+	p_histogram->samples++;
+	p_histogram->totalUs += durationUs;
+	if (durationUs > p_histogram->maxUs) {
+		p_histogram->maxUs = durationUs;
+	}
+}
+
+/*
+ *	Public function implementations
+ */
+void guiStatisticsRecordTimerHandler(const uint32_t durationUs)
+{
+	taskENTER_CRITICAL(&g_statisticsLock);
+	addSample(&g_statistics.timerHandler, durationUs, GUI_TIMER_HANDLER_HISTOGRAM_BASE_US);
+	taskEXIT_CRITICAL(&g_statisticsLock);
+}
+
+void guiStatisticsRecordFlush(const uint32_t durationUs, const uint32_t bytes, const uint32_t savedBytes)
+{
+	taskENTER_CRITICAL(&g_statisticsLock);
+	addSample(&g_statistics.flush, durationUs, GUI_FLUSH_HISTOGRAM_BASE_US);
+	g_statistics.spiBytes += bytes;
+	g_statistics.spiBytesSaved += savedBytes;
+	g_frameSpiBytesSaved += savedBytes;
+	g_statistics.flushedAreas++;
+	taskEXIT_CRITICAL(&g_statisticsLock);
+}
+
+void guiStatisticsRecordFrame()
+{
+	const int64_t nowUs = esp_timer_get_time();
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	g_statistics.frames++;
+	g_fpsWindowFrames++;
+	g_statistics.lastFrameSpiBytesSaved = g_frameSpiBytesSaved;
+	g_frameSpiBytesSaved = 0;
+
+	// Close the window once it is long enough
+	const int64_t elapsedUs = nowUs - g_fpsWindowStartUs;
+	if (elapsedUs >= FPS_WINDOW_US) {
+		g_statistics.fpsTenths = (uint16_t)((uint64_t)g_fpsWindowFrames * FPS_WINDOW_US * 10 / elapsedUs);
+		g_fpsWindowStartUs = nowUs;
+		g_fpsWindowFrames = 0;
+	}
+	taskEXIT_CRITICAL(&g_statisticsLock);
+}
+
+void guiStatisticsRecordScreenSwitch(const uint32_t latencyUs)
+{
+	taskENTER_CRITICAL(&g_statisticsLock);
+	g_statistics.screenSwitches++;
+	g_statistics.lastScreenSwitchUs = latencyUs;
+	if (latencyUs > g_statistics.maxScreenSwitchUs) {
+		g_statistics.maxScreenSwitchUs = latencyUs;
+	}
+	taskEXIT_CRITICAL(&g_statisticsLock);
+}
+
+void guiStatisticsResetDurations()
+{
+	taskENTER_CRITICAL(&g_statisticsLock);
+	memset(&g_statistics.timerHandler, 0, sizeof(GuiDurationHistogram_t));
+	memset(&g_statistics.flush, 0, sizeof(GuiDurationHistogram_t));
+	taskEXIT_CRITICAL(&g_statisticsLock);
+}
+
+void guiStatisticsGet(GuiRenderStatistics_t* p_statistics)
+{
+	if (p_statistics == NULL) {
+		return;
+	}
+
+	const int64_t nowUs = esp_timer_get_time();
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	memcpy(p_statistics, &g_statistics, sizeof(GuiRenderStatistics_t));
+
+	// Nothing was refreshed for longer than a window, so the last value is outdated
+	const int64_t elapsedUs = nowUs - g_fpsWindowStartUs;
+	if (elapsedUs >= FPS_WINDOW_US) {
+		p_statistics->fpsTenths = (uint16_t)((uint64_t)g_fpsWindowFrames * FPS_WINDOW_US * 10 / elapsedUs);
+	}
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	p_statistics->droppedSensorUpdates = sensorSnapshotGetDroppedCount();
+	lvglHeapGetStatistics(&p_statistics->lvglHeap);
+}
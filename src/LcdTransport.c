@@ -0,0 +1,285 @@
+#include "LcdTransport.h"
+
+// C includes
+#include <stddef.h>
+
+// espidf includes
+#include <driver/gpio.h>
+#include <driver/spi_common.h>
+#include <esp_lcd_io_spi.h>
+#include <esp_lcd_panel_ops.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <nvs.h>
+
+// FreeRTOS include
+#include "freertos/FreeRTOS.h"
+
+/*
+ *	Private defines
+ */
+#define LCD_SPI_HOST SPI2_HOST
+
+#define GPIO_LCD_CS GPIO_NUM_33
+#define GPIO_LCD_CLK GPIO_NUM_34
+#define GPIO_LCD_DIN GPIO_NUM_35
+#define GPIO_LCD_DC GPIO_NUM_21
+
+//! \brief Where the clock profile is stored
+#define NVS_NAMESPACE "display"
+#define NVS_KEY_SPI_CLOCK "spiClockMhz"
+
+//! \brief Used if NVS holds no valid clock profile. The clock the display always ran at, the faster profiles are
+//! opt-in through NVS (CAN 0xF1) until they are validated on the board
+#define DEFAULT_CLOCK_MHZ 10
+
+//! \brief Maximum size of one color transaction. esp_lcd splits every color transfer into transactions of the bus'
+//! maximum transfer size. With DMA the SPI driver rounds it up to whole descriptors of 4092 bytes, so the old 64 byte
+//! SOC_SPI_MAXIMUM_BUFFER_SIZE (the limit of CPU transfers) gave 4 KB transactions, about 29 per full screen
+#define TRANSACTION_SIZE_B (16 * 1024)
+
+//! \brief Queue slots for the commands which set the window of a flush
+#define COMMAND_QUEUE_SLOTS 2
+
+//! \brief Transfers which can be tracked at once. esp_lcd waits for the previous transfer before it sets the next
+//! window, so there are never more than two
+#define PENDING_TRANSFERS 4
+
+/*
+ *	Private typedefs
+ */
+//! \brief A queued transfer which didn't leave the bus yet
+typedef struct
+{
+	//! \brief When it was queued in us
+	int64_t queuedUs;
+
+	//! \brief Size of its pixels in bytes
+	uint32_t sizeB;
+} PendingTransfer_t;
+
+/*
+ *	Prototypes
+ */
+//! \brief Reads the clock profile from NVS
+//! \retval The clock in MHz
+static uint8_t loadClockProfile();
+
+//! \brief Checks if a clock is one of the supported profiles
+//! \param clockMhz The clock in MHz
+//! \retval Bool indicating if it is supported
+static bool isClockProfile(uint8_t clockMhz);
+
+//! \brief ISR called by the panel IO once the color data of a transfer left the SPI bus
+//! \retval Bool indicating if a higher priority task was woken
+static bool IRAM_ATTR onColorTransferDone(esp_lcd_panel_io_handle_t p_panelIo, esp_lcd_panel_io_event_data_t* p_eventData,
+										  void* p_userCtx);
+
+/*
+ *	Private variables
+ */
+//! \brief The supported SPI clocks in MHz
+static const uint8_t g_clockProfilesMhz[] = {10, 20, 40, 80};
+
+static esp_lcd_panel_io_handle_t g_panelIoHandle = NULL;
+static LcdTransportDoneCallback_t g_doneCallback = NULL;
+
+//! \brief The queued transfers in order, only accessed with the lock held
+static PendingTransfer_t g_pendingTransfers[PENDING_TRANSFERS];
+static uint8_t g_pendingHead = 0;
+static uint8_t g_pendingTail = 0;
+
+//! \brief When the last transfer left the bus in us, a queued transfer can't start before
+static int64_t g_lastTransferDoneUs = 0;
+
+//! \brief The statistics, only accessed with the lock held
+static LcdTransportStatistics_t g_statistics = {0};
+
+//! \brief Spinlock protecting the statistics, as they are shared with the ISR
+static portMUX_TYPE g_statisticsLock = portMUX_INITIALIZER_UNLOCKED;
+
+/*
+ *	Private function implementations
+ */
+static uint8_t loadClockProfile()
+{
+	uint8_t clockMhz = DEFAULT_CLOCK_MHZ;
+
+	nvs_handle_t nvsHandle;
+	if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvsHandle) == ESP_OK) {
+		if (nvs_get_u8(nvsHandle, NVS_KEY_SPI_CLOCK, &clockMhz) != ESP_OK || !isClockProfile(clockMhz)) {
+			clockMhz = DEFAULT_CLOCK_MHZ;
+		}
+		nvs_close(nvsHandle);
+	}
+
+	return clockMhz;
+}
+
+static bool isClockProfile(const uint8_t clockMhz)
+{
+	for (uint8_t i = 0; i < sizeof(g_clockProfilesMhz); i++) {
+		if (g_clockProfilesMhz[i] == clockMhz) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool onColorTransferDone(esp_lcd_panel_io_handle_t p_panelIo, esp_lcd_panel_io_event_data_t* p_eventData,
+								void* p_userCtx)
+{
+	const int64_t nowUs = esp_timer_get_time();
+
+	taskENTER_CRITICAL_ISR(&g_statisticsLock);
+
+	// The panel IO also reports transfers of the initialization, ignore them
+	if (g_pendingHead == g_pendingTail) {
+		taskEXIT_CRITICAL_ISR(&g_statisticsLock);
+		return false;
+	}
+
+	// A transfer queued behind another one only starts once that one is done
+	const PendingTransfer_t* p_transfer = &g_pendingTransfers[g_pendingTail];
+	g_pendingTail = (g_pendingTail + 1) % PENDING_TRANSFERS;
+	const int64_t startUs = p_transfer->queuedUs > g_lastTransferDoneUs ? p_transfer->queuedUs : g_lastTransferDoneUs;
+	const uint32_t transferUs = (uint32_t)(nowUs - startUs);
+	g_lastTransferDoneUs = nowUs;
+
+	g_statistics.bytes += p_transfer->sizeB;
+	g_statistics.busyUs += transferUs;
+	if (transferUs > g_statistics.maxTransferUs) {
+		g_statistics.maxTransferUs = transferUs;
+	}
+
+	taskEXIT_CRITICAL_ISR(&g_statisticsLock);
+
+	return g_doneCallback != NULL && g_doneCallback();
+}
+
+/*
+ *	Public function implementations
+ */
+bool lcdTransportInit(const uint32_t maxFlushB, const LcdTransportDoneCallback_t callback)
+{
+	g_doneCallback = callback;
+
+	// Create SPI bus config. The maximum transfer size also sets the amount of DMA descriptors the driver allocates
+	const spi_bus_config_t spiBusConfig = {.sclk_io_num = GPIO_LCD_CLK,
+										   .mosi_io_num = GPIO_LCD_DIN,
+										   .miso_io_num = -1,
+										   .quadwp_io_num = -1,
+										   .quadhd_io_num = -1,
+										   .max_transfer_sz = TRANSACTION_SIZE_B};
+
+	// Initialize SPI bus
+	if (spi_bus_initialize(LCD_SPI_HOST, &spiBusConfig, SPI_DMA_CH_AUTO) != ESP_OK) {
+		ESP_LOGE("LcdTransport", "Failed to initialize SPI bus");
+		return false;
+	}
+
+	// Deep enough that the largest flush is queued entirely, so queueing it never waits for the bus. For a full screen
+	// that is 10, the depth the panel IO had before. What changed is that a full screen now takes 8 transactions, not 29
+	const uint8_t clockMhz = loadClockProfile();
+	const uint32_t queueDepth = (maxFlushB + TRANSACTION_SIZE_B - 1) / TRANSACTION_SIZE_B + COMMAND_QUEUE_SLOTS;
+
+	// Create the SPI config for the LCD
+	const esp_lcd_panel_io_spi_config_t panelIoConfig = {
+		.dc_gpio_num = GPIO_LCD_DC,
+		.cs_gpio_num = GPIO_LCD_CS,
+		.pclk_hz = clockMhz * 1000 * 1000,
+		.lcd_cmd_bits = 8,
+		.lcd_param_bits = 8,
+		.spi_mode = 0,
+		.trans_queue_depth = queueDepth,
+		.on_color_trans_done = onColorTransferDone,
+		.user_ctx = NULL,
+	};
+
+	if (esp_lcd_new_panel_io_spi(LCD_SPI_HOST, &panelIoConfig, &g_panelIoHandle) != ESP_OK) {
+		ESP_LOGE("LcdTransport", "Failed to initialize the panel IO");
+		return false;
+	}
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	g_statistics.clockMhz = clockMhz;
+	g_statistics.transactionSizeB = TRANSACTION_SIZE_B;
+	g_statistics.queueDepth = (uint8_t)queueDepth;
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	ESP_LOGI("LcdTransport", "SPI clock %d MHz, %d transactions of %d bytes in flight", clockMhz, (int)queueDepth,
+			 TRANSACTION_SIZE_B);
+
+	return true;
+}
+
+esp_lcd_panel_io_handle_t lcdTransportGetPanelIo()
+{
+	return g_panelIoHandle;
+}
+
+esp_err_t lcdTransportDrawBitmap(esp_lcd_panel_handle_t panelHandle, const int xStart, const int yStart,
+								 const int xEnd, const int yEnd, const void* p_pixels, const uint32_t sizeB)
+{
+	const uint8_t transactions = (uint8_t)((sizeB + TRANSACTION_SIZE_B - 1) / TRANSACTION_SIZE_B);
+
+	// Tracked before queueing, the transfer can be done before the call returns
+	taskENTER_CRITICAL(&g_statisticsLock);
+	if (transactions > g_statistics.maxTransactionsPerFlush) {
+		g_statistics.maxTransactionsPerFlush = transactions;
+	}
+	const uint8_t slot = g_pendingHead;
+	g_pendingTransfers[slot].queuedUs = esp_timer_get_time();
+	g_pendingTransfers[slot].sizeB = sizeB;
+	g_pendingHead = (slot + 1) % PENDING_TRANSFERS;
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	const esp_err_t result = esp_lcd_panel_draw_bitmap(panelHandle, xStart, yStart, xEnd, yEnd, p_pixels);
+	if (result != ESP_OK) {
+		// Nothing was queued, so it won't be reported either
+		taskENTER_CRITICAL(&g_statisticsLock);
+		g_pendingHead = slot;
+		taskEXIT_CRITICAL(&g_statisticsLock);
+	}
+
+	return result;
+}
+
+bool lcdTransportStoreClockProfile(const uint8_t clockMhz)
+{
+	if (!isClockProfile(clockMhz)) {
+		ESP_LOGW("LcdTransport", "%d MHz is no supported SPI clock", clockMhz);
+		return false;
+	}
+
+	nvs_handle_t nvsHandle;
+	if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvsHandle) != ESP_OK) {
+		ESP_LOGE("LcdTransport", "Couldn't open NVS");
+		return false;
+	}
+
+	const bool stored =
+		nvs_set_u8(nvsHandle, NVS_KEY_SPI_CLOCK, clockMhz) == ESP_OK && nvs_commit(nvsHandle) == ESP_OK;
+	nvs_close(nvsHandle);
+
+	if (stored) {
+		ESP_LOGI("LcdTransport", "SPI clock of %d MHz is used after the next restart", clockMhz);
+	}
+
+	return stored;
+}
+
+void lcdTransportGetStatistics(LcdTransportStatistics_t* p_statistics)
+{
+	if (p_statistics == NULL) {
+		return;
+	}
+
+	taskENTER_CRITICAL(&g_statisticsLock);
+	*p_statistics = g_statistics;
+	taskEXIT_CRITICAL(&g_statisticsLock);
+
+	p_statistics->throughputKiBps =
+		p_statistics->busyUs == 0 ? 0 : (uint32_t)(p_statistics->bytes * 1000000 / 1024 / p_statistics->busyUs);
+}
@@ -0,0 +1,243 @@
+#include "LvglHeap.h"
+
+// C includes
+#include <string.h>
+
+// espidf includes
+#include <esp_heap_caps.h>
+#include <multi_heap.h>
+
+// FreeRTOS include
+#include "freertos/FreeRTOS.h"
+
+// LVGL includes
+#include "lvgl.h"
+
+/*
+ *	Private defines
+ */
+// Size of the internal RAM region. Keep it at the internal peak reported by the render statistics plus some headroom,
+// everything above spills into PSRAM. Until field data is collected it matches the former builtin pool, which is known
+// to hold all resident screens
+#define LVGL_HEAP_INTERNAL_SIZE_B (64 * 1024)
+
+/*
+ *	Prototypes
+ */
+//! \brief Checks if a pointer belongs to the internal RAM region
+//! \param p_memory The pointer
+//! \retval Bool indicating if it is part of the internal RAM region
+static bool isInternal(const void* p_memory);
+
+//! \brief Allocates memory in PSRAM and accounts for it
+//! \param size Amount of bytes
+//! \retval The memory or NULL
+static void* allocateOverflow(size_t size);
+
+//! \brief Frees memory in PSRAM and accounts for it
+//! \param p_memory The memory
+static void freeOverflow(void* p_memory);
+
+/*
+ *	Private variables
+ */
+//! \brief The internal RAM region. Being static it is placed in internal DRAM, never in PSRAM
+static uint8_t g_internalRegion[LVGL_HEAP_INTERNAL_SIZE_B] __attribute__((aligned(8)));
+
+//! \brief The TLSF heap inside of the internal RAM region
+static multi_heap_handle_t g_internalHeap = NULL;
+
+//! \brief Spinlock of the internal heap and the overflow accounting. TLSF is O(1), so the critical sections are short
+static portMUX_TYPE g_heapLock = portMUX_INITIALIZER_UNLOCKED;
+
+//! \brief Accounting of the PSRAM overflow tier, protected by g_heapLock
+static uint32_t g_overflowUsedB = 0;
+static uint32_t g_overflowPeakB = 0;
+static uint32_t g_overflowAllocations = 0;
+
+/*
+ *	Private function implementations
+ */
+static bool isInternal(const void* p_memory)
+{
+	const uint8_t* p_bytes = (const uint8_t*)p_memory;
+	return p_bytes >= g_internalRegion && p_bytes < g_internalRegion + sizeof(g_internalRegion);
+}
+
+static void* allocateOverflow(const size_t size)
+{
+	void* p_memory = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+	if (p_memory == NULL) {
+		return NULL;
+	}
+
+	const uint32_t allocatedB = heap_caps_get_allocated_size(p_memory);
+
+	taskENTER_CRITICAL(&g_heapLock);
+	g_overflowUsedB += allocatedB;
+	g_overflowAllocations++;
+	if (g_overflowUsedB > g_overflowPeakB) {
+		g_overflowPeakB = g_overflowUsedB;
+	}
+	taskEXIT_CRITICAL(&g_heapLock);
+
+	return p_memory;
+}
+
+static void freeOverflow(void* p_memory)
+{
+	const uint32_t allocatedB = heap_caps_get_allocated_size(p_memory);
+
+	taskENTER_CRITICAL(&g_heapLock);
+	g_overflowUsedB -= allocatedB;
+	taskEXIT_CRITICAL(&g_heapLock);
+
+	heap_caps_free(p_memory);
+}
+
+/*
+ *	LVGL allocator (LV_STDLIB_CUSTOM)
+ */
+void lv_mem_init()
+{
+	g_internalHeap = multi_heap_register(g_internalRegion, sizeof(g_internalRegion));
+
+	// LVGL is used from several tasks, so the heap has to be locked
+	if (g_internalHeap != NULL) {
+		multi_heap_set_lock(g_internalHeap, &g_heapLock);
+	}
+}
+
+void lv_mem_deinit()
+{
+	// The region is static, there is nothing to give back
+}
+
+lv_mem_pool_t lv_mem_add_pool(void* p_memory, size_t bytes)
+{
+	// Additional pools are not supported, the PSRAM tier takes everything which doesn't fit
+	return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+}
+
+void* lv_malloc_core(const size_t size)
+{
+	// Internal RAM first, it is where the rendering reads styles and attributes from
+	void* p_memory = g_internalHeap != NULL ? multi_heap_malloc(g_internalHeap, size) : NULL;
+	if (p_memory != NULL) {
+		return p_memory;
+	}
+
+	return allocateOverflow(size);
+}
+
+void* lv_realloc_core(void* p_memory, const size_t newSize)
+{
+	if (p_memory == NULL) {
+		return lv_malloc_core(newSize);
+	}
+
+	// Memory in PSRAM stays in PSRAM
+	if (!isInternal(p_memory)) {
+		void* p_newMemory = allocateOverflow(newSize);
+		if (p_newMemory != NULL) {
+			const size_t oldSize = heap_caps_get_allocated_size(p_memory);
+			memcpy(p_newMemory, p_memory, oldSize < newSize ? oldSize : newSize);
+			freeOverflow(p_memory);
+		}
+
+		return p_newMemory;
+	}
+
+	// Try to stay in internal RAM
+	void* p_newMemory = multi_heap_realloc(g_internalHeap, p_memory, newSize);
+	if (p_newMemory != NULL) {
+		return p_newMemory;
+	}
+
+	// The internal region is full, move the block to PSRAM
+	p_newMemory = allocateOverflow(newSize);
+	if (p_newMemory != NULL) {
+		const size_t oldSize = multi_heap_get_allocated_size(g_internalHeap, p_memory);
+		memcpy(p_newMemory, p_memory, oldSize < newSize ? oldSize : newSize);
+		multi_heap_free(g_internalHeap, p_memory);
+	}
+
+	return p_newMemory;
+}
+
+void lv_free_core(void* p_memory)
+{
+	if (p_memory == NULL) {
+		return;
+	}
+
+	if (isInternal(p_memory)) {
+		multi_heap_free(g_internalHeap, p_memory);
+	}
+	else {
+		freeOverflow(p_memory);
+	}
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t* p_monitor)
+{
+	LvglHeapStatistics_t statistics;
+	lvglHeapGetStatistics(&statistics);
+
+	// LVGL only knows about one pool, report the internal one and count the overflow as used
+	memset(p_monitor, 0, sizeof(lv_mem_monitor_t));
+	p_monitor->total_size = statistics.internalSizeB;
+	p_monitor->free_size = statistics.internalSizeB - statistics.internalUsedB;
+	p_monitor->free_biggest_size = statistics.internalLargestFreeB;
+	p_monitor->max_used = statistics.internalPeakB + statistics.overflowPeakB;
+	p_monitor->used_pct =
+		statistics.internalSizeB == 0 ? 0 : (uint8_t)((uint64_t)statistics.internalUsedB * 100 / statistics.internalSizeB);
+	p_monitor->frag_pct = statistics.fragmentationPercent;
+}
+
+lv_result_t lv_mem_test_core()
+{
+	if (g_internalHeap == NULL || !multi_heap_check(g_internalHeap, true)) {
+		return LV_RESULT_INVALID;
+	}
+
+	return LV_RESULT_OK;
+}
+
+/*
+ *	Public function implementations
+ */
+void lvglHeapGetStatistics(LvglHeapStatistics_t* p_statistics)
+{
+	if (p_statistics == NULL) {
+		return;
+	}
+
+	memset(p_statistics, 0, sizeof(LvglHeapStatistics_t));
+
+	// Takes the heap lock itself
+	if (g_internalHeap != NULL) {
+		multi_heap_info_t info;
+		multi_heap_get_info(g_internalHeap, &info);
+
+		// Without the TLSF bookkeeping
+		p_statistics->internalSizeB = info.total_free_bytes + info.total_allocated_bytes;
+		p_statistics->internalUsedB = info.total_allocated_bytes;
+		p_statistics->internalPeakB = p_statistics->internalSizeB - info.minimum_free_bytes;
+		p_statistics->internalLargestFreeB = info.largest_free_block;
+		p_statistics->fragmentationPercent =
+			info.total_free_bytes == 0
+				? 0
+				: (uint8_t)(100 - (uint64_t)info.largest_free_block * 100 / info.total_free_bytes);
+	}
+
+	taskENTER_CRITICAL(&g_heapLock);
+	p_statistics->overflowUsedB = g_overflowUsedB;
+	p_statistics->overflowPeakB = g_overflowPeakB;
+	p_statistics->overflowAllocations = g_overflowAllocations;
+	taskEXIT_CRITICAL(&g_heapLock);
+}
@@ -0,0 +1,105 @@
+#include "LvglImage.h"
+
+// C includes
+#include <string.h>
+
+// espidf includes
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+
+/*
+ *	Prototypes
+ */
+//! \brief Copies the rows of a plane with the pixels in reverse order
+//! \param p_destination The first row of the mirrored plane
+//! \param destinationStride Size of a mirrored row in bytes
+//! \param p_source The first row of the original plane
+//! \param sourceStride Size of an original row in bytes
+//! \param width Width of the image in pixels
+//! \param height Height of the image in pixels
+//! \param bytesPerPixel Size of one pixel of the plane
+static void mirrorPlane(uint8_t* p_destination, uint32_t destinationStride, const uint8_t* p_source,
+						uint32_t sourceStride, uint32_t width, uint32_t height, uint8_t bytesPerPixel);
+
+/*
+ *	Private function implementations
+ */
+static void mirrorPlane(uint8_t* p_destination, const uint32_t destinationStride, const uint8_t* p_source,
+						const uint32_t sourceStride, const uint32_t width, const uint32_t height,
+						const uint8_t bytesPerPixel)
+{
+	for (uint32_t y = 0; y < height; y++) {
+		const uint8_t* p_sourceRow = p_source + y * sourceStride;
+		uint8_t* p_destinationRow = p_destination + y * destinationStride;
+
+		for (uint32_t x = 0; x < width; x++) {
+			memcpy(&p_destinationRow[(width - 1 - x) * bytesPerPixel], &p_sourceRow[x * bytesPerPixel], bytesPerPixel);
+		}
+	}
+}
+
+/*
+ *	Public function implementations
+ */
+lv_draw_buf_t* lvglImageCreateMirrored(const lv_image_dsc_t* p_image)
+{
+	if (p_image == NULL || p_image->data == NULL) {
+		return NULL;
+	}
+
+	// Only formats with whole bytes per pixel, indexed images would need their bits reordered
+	uint8_t bytesPerPixel = 0;
+	switch (p_image->header.cf) {
+		case LV_COLOR_FORMAT_A8:
+			bytesPerPixel = 1;
+			break;
+		case LV_COLOR_FORMAT_RGB565:
+		case LV_COLOR_FORMAT_RGB565A8:
+			bytesPerPixel = 2;
+			break;
+		case LV_COLOR_FORMAT_ARGB8888:
+			bytesPerPixel = 4;
+			break;
+		default:
+			return NULL;
+	}
+
+	const uint32_t width = p_image->header.w;
+	const uint32_t height = p_image->header.h;
+	const uint32_t sourceStride = p_image->header.stride != 0 ? p_image->header.stride : width * bytesPerPixel;
+
+	// The alpha plane follows the colors with half of their stride
+	const uint32_t destinationStride = lv_draw_buf_width_to_stride(width, p_image->header.cf);
+	uint32_t dataSizeB = destinationStride * height;
+	if (p_image->header.cf == LV_COLOR_FORMAT_RGB565A8) {
+		dataSizeB += destinationStride / 2 * height;
+	}
+
+	// The copy is drawn like any other image, so it belongs into internal RAM. The LVGL heap would move it to PSRAM
+	// once its internal region is full
+	const size_t sizeB = sizeof(lv_draw_buf_t) + dataSizeB;
+	lv_draw_buf_t* p_mirrored = heap_caps_malloc(sizeB, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (p_mirrored == NULL) {
+		ESP_LOGW("LvglImage", "No internal RAM for a mirrored image (%lu B), using PSRAM", (unsigned long)sizeB);
+		p_mirrored = heap_caps_malloc(sizeB, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+		if (p_mirrored == NULL) {
+			return NULL;
+		}
+	}
+	lv_draw_buf_init(p_mirrored, width, height, p_image->header.cf, destinationStride, p_mirrored + 1, dataSizeB);
+
+	mirrorPlane(p_mirrored->data, destinationStride, p_image->data, sourceStride, width, height, bytesPerPixel);
+
+	if (p_image->header.cf == LV_COLOR_FORMAT_RGB565A8) {
+		mirrorPlane(p_mirrored->data + destinationStride * height, destinationStride / 2,
+					p_image->data + sourceStride * height, sourceStride / 2, width, height, 1);
+	}
+
+	return p_mirrored;
+}
+
+void lvglImageDestroyMirrored(lv_draw_buf_t* p_mirrored)
+{
+	// The pixels are part of the same block
+	heap_caps_free(p_mirrored);
+}
@@ -1,37 +1,150 @@
 #include "../../include/Managers/CanUpdateManager.h"
 
 // Project includes
+#include "CanDispatcher.h"
 #include "GUI.h"
 #include "Managers/ManagerUtils.h"
+#include "TaskTopology.h"
 #include "can.h"
 
 // C includes
+#include <stdatomic.h>
 #include <stdlib.h>
+#include <string.h>
 
 // espidf includes
 #include <esp_log.h>
 #include <esp_ota_ops.h>
+#include <esp_timer.h>
 #include <esp_partition.h>
 
 // FreeRTOS include
 #include "freertos/FreeRTOS.h"
 
+// miniz (inflate) from the ROM
+#include "miniz.h"
+
+/*
+ *	PREPARE frame layout, selected by bit 7 of byte 1 and never by the dlc, so padded frames are read the same way
+ *
+ *	Legacy update (bit 7 of byte 1 clear), everything after byte 4 is ignored:
+ *		[1..4] Size of the update file (big endian), per-block acknowledged and uncompressed
+ *
+ *	Negotiated update (bit 7 of byte 1 set, dlc 8):
+ *		[1]    Flags: bit 7 set, bit 6 the file is a zlib stream, bits 0..5 requested window size (0 per-block)
+ *		[2..4] Size of the file which is transferred (big endian)
+ *		[5..7] Size of the image written to the partition (big endian), the same as [2..4] if uncompressed
+ *
+ *	A legacy update can't be mistaken for a negotiated one, bit 7 of byte 1 would be a file of at least 2 GiB
+ */
+
 /*
  *  Private defines
  */
 #define UPDATE_PART_SIZE_B 7
 
+//! \brief Size of one staging buffer, matches a flash sector so every commit writes whole sectors
+#define STAGING_BUFFER_SIZE_B 4096
+#define STAGING_BUFFER_COUNT 2
+
+//! \brief Maximum time EXECUTE waits for the flash writer to commit the remaining buffers
+#define FLASH_WRITER_DRAIN_TIMEOUT_MS 2000
+
+//! \brief Largest window (unacknowledged blocks) we accept. Must be below 128, so the 8 bit sequence number of a
+//! block is unambiguous, and should not exceed the depth of the update manager queue
+#define UPDATE_MAX_WINDOW_SIZE 16
+
+//! \brief Types of the acknowledgements of the windowed transfer
+#define UPDATE_ACK 0
+#define UPDATE_NACK 1
+
+//! \brief Flags of a negotiated PREPARE frame
+#define PREPARE_FLAG_NEGOTIATED 0x80
+#define PREPARE_FLAG_COMPRESSED 0x40
+#define PREPARE_WINDOW_SIZE_MASK 0x3F
+
 /*
- *	Private variables
+ *	Private typedefs
  */
-//! \brief Task handle of the CAN task
-static TaskHandle_t g_taskHandle;
+//! \brief A staging buffer handed to the flash writer task
+typedef struct
+{
+	//! \brief Index of the staging buffer
+	uint8_t index;
+
+	//! \brief Amount of valid bytes in the buffer
+	uint16_t length;
+} StagingBuffer_t;
 
-//! \brief Bool indicating if an update is in progress
+/*
+ *	Private variables
+ */
+//! \brief Size of the update file which is transferred
 static uint32_t g_sizeB = 0;
-static uint8_t* g_buffer = NULL;
+
+//! \brief Size of the image written to the partition. Differs from g_sizeB if the update file is compressed
+static uint32_t g_imageSizeB = 0;
+
+//! \brief Amount of bytes received so far
+static uint32_t g_byteIndex = 0;
 static uint32_t g_block = 0;
 
+//! \brief Amount of image bytes handed to the staging buffers so far
+static uint32_t g_imageByteIndex = 0;
+
+//! \brief Bool indicating if the update file is a zlib stream
+static bool g_compressed = false;
+
+//! \brief State of the inflater. Only allocated during compressed updates
+static tinfl_decompressor* g_inflater = NULL;
+static uint8_t* g_dictionary = NULL;
+static uint32_t g_dictionaryOffset = 0;
+static tinfl_status g_inflateStatus = TINFL_STATUS_NEEDS_MORE_INPUT;
+
+//! \brief Negotiated window size of the transfer. 0 means every block is acknowledged on its own
+static uint8_t g_windowSize = 0;
+
+//! \brief Sequence number of the next block we expect in windowed mode
+static uint8_t g_expectedSequence = 0;
+
+//! \brief Amount of blocks received in order since the last cumulative acknowledgement
+static uint8_t g_blocksSinceAck = 0;
+
+//! \brief Bool indicating if the current gap was already reported with a NACK
+static bool g_nackSent = false;
+
+//! \brief Timestamp in us at which the transfer was prepared, used to calculate the throughput
+static int64_t g_transferStartUs = 0;
+
+//! \brief The partition and OTA handle the update is written to
+static const esp_partition_t* g_updatePartition = NULL;
+static esp_ota_handle_t g_updateHandle = 0;
+
+//! \brief Double buffered staging area. One buffer is filled by the CAN task while the other one is written to flash
+static uint8_t g_stagingBuffers[STAGING_BUFFER_COUNT][STAGING_BUFFER_SIZE_B] __attribute__((aligned(4)));
+
+//! \brief The staging buffer which is currently filled
+static StagingBuffer_t g_currentBuffer;
+static bool g_currentBufferValid = false;
+
+//! \brief Full buffers waiting to be written and empty buffers ready to be filled
+static QueueHandle_t g_fullBufferQueue = NULL;
+static QueueHandle_t g_freeBufferQueue = NULL;
+
+//! \brief Amount of buffers handed to the flash writer which are not written yet
+static atomic_uint g_pendingBuffers = 0;
+
+//! \brief Bool indicating if the flash writer failed to write a buffer. Also set by an abort, so the flash writer
+//! skips the buffers which are still queued
+static volatile bool g_writeFailed = false;
+
+//! \brief Handle of an aborted update the flash writer was still writing to. The flash writer aborts it once it is
+//! idle, no new update can start before
+static esp_ota_handle_t g_deferredAbortHandle = 0;
+
+//! \brief Spinlock deciding whether the flash writer or the abort frees the handle
+static portMUX_TYPE g_abortLock = portMUX_INITIALIZER_UNLOCKED;
+
 /*
  *	Prototypes
  */
@@ -39,15 +152,54 @@ static uint32_t g_block = 0;
 //! \retval Bool indicating if the preparations were successful
 static bool prepareUpdate();
 
-//! \brief Writes a block of bytes to the update buffer
+//! \brief Writes a block of bytes to the update buffer. The inflater and the staging buffers can't be rolled back, so
+//! a block which can't be written aborts the update
 //! \param p_bytes The array of bytes
 //! \param amount Amount of bytes to write
-static void writeFileBlock(const uint8_t* p_bytes, uint8_t amount);
+//! \retval Bool indicating if the block was written
+static bool writeFileBlock(const uint8_t* p_bytes, uint8_t amount);
 
 //! \brief Tries to execute the update
 //! \retval Bool indicating if the update succeeded
 static bool executeUpdate();
 
+//! \brief Aborts the running update and lets the GUI refresh again
+static void abortUpdate();
+
+//! \brief Copies image bytes into the staging buffers
+//! \param p_bytes The array of bytes
+//! \param amount Amount of bytes to copy
+//! \retval Bool indicating if the bytes were staged
+static bool stageImageBytes(const uint8_t* p_bytes, uint32_t amount);
+
+//! \brief Decompresses a block of the compressed update file into the staging buffers
+//! \param p_bytes The array of compressed bytes
+//! \param amount Amount of compressed bytes
+//! \retval Bool indicating if the block could be decompressed
+static bool inflateFileBlock(const uint8_t* p_bytes, uint8_t amount);
+
+//! \brief Frees the memory of the inflater
+static void freeInflater();
+
+//! \brief Hands the current staging buffer to the flash writer and takes the next free one
+//! \retval Bool indicating if a free buffer could be taken
+static bool commitCurrentBuffer();
+
+//! \brief Waits until the flash writer wrote all buffers handed to it
+//! \retval Bool indicating if the flash writer finished in time
+static bool waitForFlashWriter();
+
+//! \brief Aborts the handle an abort left to the flash writer. Called by the flash writer once it is idle
+static void finishDeferredAbort();
+
+//! \brief Handles a block of the update file in windowed mode
+//! \param p_message The CAN message containing the sequence number and the block
+static void handleWindowedBlock(const CanMessage_t* p_message);
+
+//! \brief Sends a (cumulative) acknowledgement of the windowed transfer
+//! \param type UPDATE_ACK or UPDATE_NACK
+static void sendWindowAck(uint8_t type);
+
 /*
  *	Tasks
  */
@@ -55,32 +207,60 @@ static bool executeUpdate();
 //! \param p_param Unused parameters
 static void canTask(void* p_param)
 {
-	// Wait for new queue events
-	TwaiFrame_t rxFrame;
+	// Wait for new queue events. The dispatcher only delivers our messages of the master
+	CanMessage_t message;
 	while (true) {
 		// Wait until we get a new event in the queue
-		if (xQueueReceive(g_canUpdateManagerQueue, &rxFrame, portMAX_DELAY) != pdPASS) {
-			continue;
-		}
-
-		// Skip if it's not from the master
-		if ((rxFrame.espidfFrame.header.id & 0x1FFFFF) != 0) {
+		if (!EVENT_BUS_RECEIVE(CAN_UPDATE, &message, portMAX_DELAY)) {
 			continue;
 		}
 
 		// Get the message id
-		const uint8_t frameId = rxFrame.espidfFrame.header.id >> CAN_FRAME_ID_OFFSET;
+		const uint8_t frameId = message.messageId;
 
 		// Act depending on the CAN message
 		if (frameId == CAN_MSG_PREPARE_UPDATE) {
-			// Get the update file size
-			g_sizeB = rxFrame.buffer[1] << 24;
-			g_sizeB += rxFrame.buffer[2] << 16;
-			g_sizeB += rxFrame.buffer[3] << 8;
-			g_sizeB += rxFrame.buffer[4];
+			uint8_t requestedWindowSize = 0;
+			const uint8_t flags = message.dlc > 1 ? message.buffer[1] : 0;
+			if ((flags & PREPARE_FLAG_NEGOTIATED) != 0) {
+				if (message.dlc < 8) {
+					ESP_LOGE("main", "Negotiated update with only %d bytes, ignoring it", message.dlc);
+
+					continue;
+				}
+
+				// Get the transferred file and the image size
+				g_compressed = (flags & PREPARE_FLAG_COMPRESSED) != 0;
+				g_sizeB = message.buffer[2] << 16;
+				g_sizeB += message.buffer[3] << 8;
+				g_sizeB += message.buffer[4];
+				g_imageSizeB = message.buffer[5] << 16;
+				g_imageSizeB += message.buffer[6] << 8;
+				g_imageSizeB += message.buffer[7];
+				requestedWindowSize = flags & PREPARE_WINDOW_SIZE_MASK;
+
+				if (!g_compressed && g_imageSizeB != g_sizeB) {
+					ESP_LOGE("main", "Uncompressed update with differing file and image size, ignoring it");
+
+					continue;
+				}
+			}
+			else {
+				// Get the update file size, whatever follows it is padding
+				g_compressed = false;
+				g_sizeB = message.buffer[1] << 24;
+				g_sizeB += message.buffer[2] << 16;
+				g_sizeB += message.buffer[3] << 8;
+				g_sizeB += message.buffer[4];
+				g_imageSizeB = g_sizeB;
+			}
+
+			// The sender may offer a windowed transfer, we accept up to our maximum window size
+			g_windowSize = requestedWindowSize > UPDATE_MAX_WINDOW_SIZE ? UPDATE_MAX_WINDOW_SIZE : requestedWindowSize;
 
 			// Logging
-			ESP_LOGI("main", "Received Update File Size: %d", g_sizeB);
+			ESP_LOGI("main", "Received Update File Size: %d, image size: %d, window size: %d", g_sizeB, g_imageSizeB,
+					 g_windowSize);
 
 			// Init the update handler
 			if (!prepareUpdate()) {
@@ -92,8 +272,11 @@ static void canTask(void* p_param)
 			// Create the CAN answer frame
 			TwaiFrame_t frame;
 
+			// Tell the sender the accepted window size. Senders without windowed mode still get the empty answer
+			frame.buffer[0] = g_windowSize;
+
 			// Initiate the frame
-			canInitiateFrame(&frame, CAN_MSG_PREPARE_UPDATE, 0);
+			canInitiateFrame(&frame, CAN_MSG_PREPARE_UPDATE, g_windowSize > 0 ? 1 : 0);
 
 			// Send the frame
 			canQueueFrame(&frame);
@@ -103,7 +286,17 @@ static void canTask(void* p_param)
 
 		// Block of the update file
 		if (frameId == CAN_MSG_TRANSMIT_UPDATE_FILE) {
-			writeFileBlock(rxFrame.buffer + 1, rxFrame.espidfFrame.header.dlc - 1);
+			// Windowed transfer, only every few blocks are acknowledged
+			if (g_windowSize > 0) {
+				handleWindowedBlock(&message);
+
+				continue;
+			}
+
+			// Without an answer the sender stops the transfer instead of sending the rest of a broken image
+			if (!writeFileBlock(message.buffer + 1, message.dlc - 1)) {
+				continue;
+			}
 
 			// Create the CAN answer frame
 			TwaiFrame_t frame;
@@ -138,23 +331,117 @@ static void canTask(void* p_param)
 	}
 }
 
+//! \brief Low priority task which commits full staging buffers to the OTA partition while the transfer runs
+//! \param p_param Unused parameters
+static void flashWriterTask(void* p_param)
+{
+	StagingBuffer_t buffer;
+	while (true) {
+		// Wait for a full buffer
+		if (xQueueReceive(g_fullBufferQueue, &buffer, portMAX_DELAY) != pdPASS) {
+			continue;
+		}
+
+		// Write it, unless a previous buffer already failed
+		if (!g_writeFailed &&
+			esp_ota_write(g_updateHandle, g_stagingBuffers[buffer.index], buffer.length) != ESP_OK) {
+			ESP_LOGE("UpdateHandler", "Couldn't write %d bytes to the update partition", buffer.length);
+
+			g_writeFailed = true;
+		}
+
+		// The buffer can be filled again
+		buffer.length = 0;
+		xQueueSend(g_freeBufferQueue, &buffer, portMAX_DELAY);
+		if (atomic_fetch_sub(&g_pendingBuffers, 1) == 1) {
+			finishDeferredAbort();
+		}
+	}
+}
+
 /*
  *	Private functions
  */
 static bool prepareUpdate()
 {
-	// Reset the file block
-	g_block = 0;
+	// An update is still running, throw it away
+	if (g_canUpdateActive) {
+		ESP_LOGW("UpdateHandler", "Received a new update while one was running. Aborting the old one");
+		abortUpdate();
+	}
 
-	// Allocate the memory
-	g_buffer = (uint8_t*)malloc(g_sizeB);
-	if (g_buffer == NULL) {
-		ESP_LOGE("UpdateHandler", "Couldn't allocate %d bytes for the update file", g_sizeB);
+	// The flash writer still holds the handle of an aborted update, the partition can't be reused yet
+	taskENTER_CRITICAL(&g_abortLock);
+	const bool abortDeferred = g_deferredAbortHandle != 0;
+	taskEXIT_CRITICAL(&g_abortLock);
+	if (abortDeferred) {
+		ESP_LOGE("UpdateHandler", "Flash writer is still busy with the aborted update");
 		return false;
 	}
 
-	// Clear the buffer
-	memset(g_buffer, 0, g_sizeB);
+	// Check the size
+	if (g_sizeB == 0 || g_imageSizeB == 0) {
+		ESP_LOGE("UpdateHandler", "Received an update file size of 0 bytes");
+		return false;
+	}
+
+	// Get the update OTA partition
+	g_updatePartition = esp_ota_get_next_update_partition(NULL);
+	if (g_updatePartition == NULL) {
+		ESP_LOGE("UpdateHandler", "Couldn't find update partition!");
+		return false;
+	}
+
+	if (g_imageSizeB > g_updatePartition->size) {
+		ESP_LOGE("UpdateHandler", "Update file of %d bytes doesn't fit into partition %s", g_imageSizeB,
+				 g_updatePartition->label);
+		return false;
+	}
+
+	// A compressed update is inflated while it is received, which needs the inflater and its dictionary
+	if (g_compressed) {
+		g_inflater = malloc(sizeof(tinfl_decompressor));
+		g_dictionary = malloc(TINFL_LZ_DICT_SIZE);
+		if (g_inflater == NULL || g_dictionary == NULL) {
+			ESP_LOGE("UpdateHandler", "Couldn't allocate the inflater");
+
+			freeInflater();
+			return false;
+		}
+
+		tinfl_init(g_inflater);
+		g_dictionaryOffset = 0;
+		g_inflateStatus = TINFL_STATUS_NEEDS_MORE_INPUT;
+	}
+
+	// Initiate the partition. Sectors are erased as they are written, so this returns immediately
+	if (esp_ota_begin(g_updatePartition, OTA_WITH_SEQUENTIAL_WRITES, &g_updateHandle) != ESP_OK) {
+		ESP_LOGE("UpdateHandler", "Couldn't initiate update partition");
+
+		freeInflater();
+		return false;
+	}
+
+	// Reset the transfer
+	g_block = 0;
+	g_byteIndex = 0;
+	g_imageByteIndex = 0;
+	g_writeFailed = false;
+	g_expectedSequence = 0;
+	g_blocksSinceAck = 0;
+	g_nackSent = false;
+	g_transferStartUs = esp_timer_get_time();
+
+	// Hand out all staging buffers
+	xQueueReset(g_fullBufferQueue);
+	xQueueReset(g_freeBufferQueue);
+	for (uint8_t i = 1; i < STAGING_BUFFER_COUNT; i++) {
+		const StagingBuffer_t buffer = {.index = i, .length = 0};
+		xQueueSend(g_freeBufferQueue, &buffer, 0);
+	}
+	g_currentBuffer.index = 0;
+	g_currentBuffer.length = 0;
+	g_currentBufferValid = true;
 
 	// We are now in an update procedure
 	g_canUpdateActive = true;
@@ -162,103 +449,285 @@ static bool prepareUpdate()
 	// Stop the GUI from refreshing to boost performance
 	guiDeactivateRefreshing();
 
+	// Logging
+	ESP_LOGI("UpdateHandler", "Streaming update file to partition %s", g_updatePartition->label);
+
 	return true;
 }
 
-static void writeFileBlock(const uint8_t* p_bytes, const uint8_t amount)
+static bool writeFileBlock(const uint8_t* p_bytes, const uint8_t amount)
 {
 	if (p_bytes == NULL) {
 		ESP_LOGE("UpdateHandler", "Received NULL pointer to write to the update buffer");
-		return;
+		return false;
 	}
-	if (g_buffer == NULL) {
+	if (!g_canUpdateActive || !g_currentBufferValid) {
 		ESP_LOGE("CanUpdater", "No update file buffer initialized");
 
-		return;
+		return false;
 	}
 
-	static uint32_t s_byteIndex = 0;
-
 	// Overflow check
-	if (s_byteIndex >= g_sizeB || s_byteIndex + amount > g_sizeB) {
+	if (g_byteIndex >= g_sizeB || g_byteIndex + amount > g_sizeB) {
 		ESP_LOGE("UpdateHandler", "Update Buffer Overflow in block %d, byte index: %d, amount: %d, update size: %ld",
-				 g_block, s_byteIndex, amount, g_sizeB);
-		return;
+				 g_block, g_byteIndex, amount, g_sizeB);
+
+		abortUpdate();
+		return false;
 	}
 
-	// Then copy the memory into the buffer
-	memcpy(g_buffer + s_byteIndex, p_bytes, amount);
+	// Compressed blocks are inflated first, everything else goes into the staging buffers as is
+	const bool success = g_compressed ? inflateFileBlock(p_bytes, amount) : stageImageBytes(p_bytes, amount);
+	if (!success) {
+		ESP_LOGE("UpdateHandler", "Couldn't write block %d. Aborting", g_block);
+
+		abortUpdate();
+		return false;
+	}
 
 	// Calculate the next index
-	s_byteIndex += amount;
+	g_byteIndex += amount;
 	g_block++;
 
 	// Logging
 	if (g_block % 1000 == 0 || amount != UPDATE_PART_SIZE_B) {
 		ESP_LOGI("UpdateHandler", "Block %d: Wrote %d bytes to the update file buffer", g_block, amount);
 	}
+
+	return true;
 }
 
-static bool executeUpdate()
+static bool stageImageBytes(const uint8_t* p_bytes, const uint32_t amount)
 {
-	if (g_buffer == NULL) {
-		ESP_LOGE("UpdateHandler", "Couldn't update, update file Buffer is empty!");
+	// Overflow check
+	if (g_imageByteIndex + amount > g_imageSizeB) {
+		ESP_LOGE("UpdateHandler", "Image overflow, byte index: %d, amount: %d, image size: %d", g_imageByteIndex,
+				 amount, g_imageSizeB);
 		return false;
 	}
 
-	// Get the update OTA partition
-	const esp_partition_t* updatePartition = esp_ota_get_next_update_partition(NULL);
-	if (updatePartition == NULL) {
-		ESP_LOGE("UpdateHandler", "Couldn't find update partition!");
-		return false;
+	// Copy the bytes into the staging buffer, they can span multiple buffers
+	uint32_t copied = 0;
+	while (copied < amount) {
+		const uint32_t space = STAGING_BUFFER_SIZE_B - g_currentBuffer.length;
+		const uint32_t chunk = (amount - copied) < space ? (amount - copied) : space;
+
+		memcpy(g_stagingBuffers[g_currentBuffer.index] + g_currentBuffer.length, p_bytes + copied, chunk);
+		g_currentBuffer.length += chunk;
+		copied += chunk;
+
+		// Hand full buffers to the flash writer
+		if (g_currentBuffer.length == STAGING_BUFFER_SIZE_B && !commitCurrentBuffer()) {
+			return false;
+		}
 	}
 
-	// Logging
-	ESP_LOGI("UpdateHandler", "Writing update file to partition %s", updatePartition->label);
+	g_imageByteIndex += amount;
 
-	// Initiate partition
-	esp_ota_handle_t updateHandle;
-	if (esp_ota_begin(updatePartition, g_sizeB, &updateHandle) != ESP_OK) {
-		ESP_LOGE("UpdateHandler", "Couldn't initiate update partition");
+	return true;
+}
 
-		// Update failed
-		g_canUpdateActive = false;
+static bool inflateFileBlock(const uint8_t* p_bytes, const uint8_t amount)
+{
+	if (g_inflater == NULL || g_dictionary == NULL || g_inflateStatus == TINFL_STATUS_DONE) {
+		ESP_LOGE("UpdateHandler", "Received compressed data after the end of the stream");
 		return false;
 	}
 
-	// Write the update file
-	for (uint32_t i = 0; i < g_sizeB; i++) {
-		// Write to the partition
-		if (esp_ota_write(updateHandle, g_buffer + i, 1) != ESP_OK) {
-			ESP_LOGE("UpdateHandler", "Couldn't write update block %d. Aborting", i);
+	// Only the last block of the file may end the stream
+	const bool lastBlock = g_byteIndex + amount >= g_sizeB;
+	const mz_uint32 flags = TINFL_FLAG_PARSE_ZLIB_HEADER | (lastBlock ? 0 : TINFL_FLAG_HAS_MORE_INPUT);
 
-			esp_ota_abort(updateHandle);
+	uint32_t consumed = 0;
+	while (true) {
+		// The dictionary is a ring buffer which also holds the output
+		size_t inBytes = amount - consumed;
+		size_t outBytes = TINFL_LZ_DICT_SIZE - g_dictionaryOffset;
+		g_inflateStatus = tinfl_decompress(g_inflater, p_bytes + consumed, &inBytes, g_dictionary,
+										   g_dictionary + g_dictionaryOffset, &outBytes, flags);
+		consumed += inBytes;
+
+		// Stage what was decompressed
+		if (outBytes > 0) {
+			if (!stageImageBytes(g_dictionary + g_dictionaryOffset, outBytes)) {
+				return false;
+			}
+			g_dictionaryOffset = (g_dictionaryOffset + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+		}
+
+		if (g_inflateStatus < TINFL_STATUS_DONE) {
+			ESP_LOGE("UpdateHandler", "Couldn't decompress block %d: %d", g_block, g_inflateStatus);
 			return false;
 		}
+
+		// Either the stream ended or the block is consumed, otherwise the dictionary was full and there is more output
+		if (g_inflateStatus != TINFL_STATUS_HAS_MORE_OUTPUT) {
+			return true;
+		}
+	}
+}
+
+static void freeInflater()
+{
+	free(g_inflater);
+	free(g_dictionary);
+	g_inflater = NULL;
+	g_dictionary = NULL;
+}
+
+static void handleWindowedBlock(const CanMessage_t* p_message)
+{
+	// Needs at least the sequence number and one byte. After an abort nothing is acknowledged anymore, so the sender
+	// stops within a window
+	if (p_message->dlc < 2 || !g_canUpdateActive) {
+		return;
+	}
+
+	const uint8_t sequence = p_message->buffer[0];
+	const uint8_t distance = (uint8_t)(sequence - g_expectedSequence);
+
+	// A block we already have, probably retransmitted because our acknowledgement got lost. Repeat it
+	if (distance >= 128) {
+		sendWindowAck(UPDATE_ACK);
+
+		return;
+	}
+
+	// A block is missing. Drop everything until the sender retransmitted it, starting at the expected sequence
+	if (distance != 0) {
+		if (!g_nackSent) {
+			ESP_LOGW("UpdateHandler", "Expected block sequence %d, got %d. Requesting retransmission",
+					 g_expectedSequence, sequence);
+
+			sendWindowAck(UPDATE_NACK);
+			g_nackSent = true;
+		}
+
+		return;
+	}
+
+	// The expected block. If it can't be written the update is aborted and the sequence stays where it failed
+	if (!writeFileBlock(p_message->buffer + 1, p_message->dlc - 1)) {
+		return;
+	}
+	g_expectedSequence++;
+	g_blocksSinceAck++;
+	g_nackSent = false;
+
+	// Acknowledge all blocks received so far every half window, so the sender never stalls, and after the last block
+	const uint8_t ackInterval = g_windowSize > 1 ? g_windowSize / 2 : 1;
+	if (g_blocksSinceAck >= ackInterval || g_byteIndex >= g_sizeB) {
+		sendWindowAck(UPDATE_ACK);
+	}
+}
+
+static void sendWindowAck(const uint8_t type)
+{
+	// Create the CAN answer frame
+	TwaiFrame_t frame;
+
+	// Set the buffer content, every block before the expected sequence was received
+	frame.buffer[0] = type;
+	frame.buffer[1] = g_expectedSequence;
+
+	// Initiate the frame
+	canInitiateFrame(&frame, CAN_MSG_TRANSMIT_UPDATE_FILE, 2);
+
+	// Send the frame
+	canQueueFrame(&frame);
+
+	g_blocksSinceAck = 0;
+}
+
+static bool commitCurrentBuffer()
+{
+	atomic_fetch_add(&g_pendingBuffers, 1);
+	xQueueSend(g_fullBufferQueue, &g_currentBuffer, portMAX_DELAY);
+
+	// Wait for the flash writer to free a buffer. This only blocks if the flash is slower than the CAN bus
+	if (xQueueReceive(g_freeBufferQueue, &g_currentBuffer, pdMS_TO_TICKS(FLASH_WRITER_DRAIN_TIMEOUT_MS)) != pdPASS) {
+		ESP_LOGE("UpdateHandler", "Flash writer didn't free a staging buffer");
+
+		g_currentBufferValid = false;
+		return false;
+	}
+
+	return true;
+}
+
+static bool executeUpdate()
+{
+	if (!g_canUpdateActive || !g_currentBufferValid) {
+		ESP_LOGE("UpdateHandler", "Couldn't update, no update is in progress!");
+		return false;
+	}
+
+	// Check if we received everything
+	if (g_byteIndex != g_sizeB) {
+		ESP_LOGE("UpdateHandler", "Received %d of %d bytes. Aborting", g_byteIndex, g_sizeB);
+
+		abortUpdate();
+		return false;
+	}
+
+	// Check if the compressed stream ended and decompressed to exactly the announced image
+	if (g_compressed && (g_inflateStatus != TINFL_STATUS_DONE || g_imageByteIndex != g_imageSizeB)) {
+		ESP_LOGE("UpdateHandler", "Decompressed %d of %d bytes. Aborting", g_imageByteIndex, g_imageSizeB);
+
+		abortUpdate();
+		return false;
+	}
+	freeInflater();
+
+	// Commit the last, partially filled buffer
+	if (g_currentBuffer.length > 0) {
+		atomic_fetch_add(&g_pendingBuffers, 1);
+		xQueueSend(g_fullBufferQueue, &g_currentBuffer, portMAX_DELAY);
+	}
+	g_currentBufferValid = false;
+
+	// Wait until everything is in flash
+	if (!waitForFlashWriter()) {
+		ESP_LOGE("UpdateHandler", "Flash writer didn't finish. Aborting");
+
+		abortUpdate();
+		return false;
+	}
+
+	if (g_writeFailed) {
+		ESP_LOGE("UpdateHandler", "Writing the update failed. Aborting");
+
+		abortUpdate();
+		return false;
 	}
 
 	// Finish the update
-	if (esp_ota_end(updateHandle) != ESP_OK) {
+	if (esp_ota_end(g_updateHandle) != ESP_OK) {
 		ESP_LOGE("UpdateHandler", "Couldn't end update partition");
-		esp_ota_abort(updateHandle);
 
-		// Update failed
-		g_canUpdateActive = false;
+		// esp_ota_end() already freed the handle
+		g_updateHandle = 0;
+		abortUpdate();
 		return false;
 	}
+	g_updateHandle = 0;
 
 	// Switch data partition
-	if (esp_ota_set_boot_partition(updatePartition) != ESP_OK) {
+	if (esp_ota_set_boot_partition(g_updatePartition) != ESP_OK) {
 		ESP_LOGE("UpdateHandler", "Couldn't switch to update partition");
-		esp_ota_abort(updateHandle);
 
-		// Update failed
-		g_canUpdateActive = false;
+		abortUpdate();
 		return false;
 	}
 
-	ESP_LOGI("UpdateHandler", "Wrote %d bytes to partition %s", g_sizeB, updatePartition->label);
-	free(g_buffer);
+	ESP_LOGI("UpdateHandler", "Wrote %d bytes to partition %s", g_imageSizeB, g_updatePartition->label);
+
+	// Report the throughput of the transfer
+	const int64_t transferMs = (esp_timer_get_time() - g_transferStartUs) / 1000;
+	ESP_LOGI("UpdateHandler", "Transfer took %lld ms (%lld B/s, %lld image B/s) in %s%s mode", transferMs,
+			 transferMs > 0 ? (int64_t)g_sizeB * 1000 / transferMs : 0,
+			 transferMs > 0 ? (int64_t)g_imageSizeB * 1000 / transferMs : 0, g_windowSize > 0 ? "windowed" : "per-block",
+			 g_compressed ? ", compressed" : "");
 
 	// Reactivate the refreshing of the GUI
 	guiActivateRefreshing();
@@ -269,20 +738,98 @@ static bool executeUpdate()
 	return true;
 }
 
+static bool waitForFlashWriter()
+{
+	for (uint32_t waitedMs = 0; atomic_load(&g_pendingBuffers) > 0; waitedMs += 10) {
+		if (waitedMs >= FLASH_WRITER_DRAIN_TIMEOUT_MS) {
+			return false;
+		}
+
+		vTaskDelay(pdMS_TO_TICKS(10));
+	}
+
+	return true;
+}
+
+static void finishDeferredAbort()
+{
+	taskENTER_CRITICAL(&g_abortLock);
+	const esp_ota_handle_t handle = g_deferredAbortHandle;
+	g_deferredAbortHandle = 0;
+	taskEXIT_CRITICAL(&g_abortLock);
+
+	if (handle != 0) {
+		esp_ota_abort(handle);
+		ESP_LOGI("UpdateHandler", "Flash writer is idle again, aborted the update");
+	}
+}
+
+static void abortUpdate()
+{
+	// Let the flash writer skip the queued buffers and finish the one it is writing
+	g_writeFailed = true;
+	if (!waitForFlashWriter()) {
+		ESP_LOGE("UpdateHandler", "Flash writer is stuck, it aborts the update once it is idle");
+	}
+	g_currentBufferValid = false;
+
+	freeInflater();
+
+	// Throw the partially written update away. The handle mustn't be freed while the flash writer still writes to it,
+	// so if it is busy it frees the handle itself once its last buffer is done
+	if (g_updateHandle != 0) {
+		taskENTER_CRITICAL(&g_abortLock);
+		const bool writerBusy = atomic_load(&g_pendingBuffers) > 0;
+		if (writerBusy) {
+			g_deferredAbortHandle = g_updateHandle;
+		}
+		taskEXIT_CRITICAL(&g_abortLock);
+
+		if (!writerBusy) {
+			esp_ota_abort(g_updateHandle);
+		}
+		g_updateHandle = 0;
+	}
+
+	// Reactivate the refreshing of the GUI
+	guiActivateRefreshing();
+
+	// Update failed
+	g_canUpdateActive = false;
+}
+
 /*
  *	Public function implementations
  */
 bool canUpdateManagerInit()
 {
-	// Register to the CAN rx cb
-	if (!canRegisterRxCbQueue(&g_canUpdateManagerQueue)) {
-		ESP_LOGE("DisplayUpdate", "Couldn't register rx cb queue");
+	// Create the staging buffer queues
+	g_fullBufferQueue = xQueueCreate(STAGING_BUFFER_COUNT, sizeof(StagingBuffer_t));
+	g_freeBufferQueue = xQueueCreate(STAGING_BUFFER_COUNT, sizeof(StagingBuffer_t));
+	if (g_fullBufferQueue == NULL || g_freeBufferQueue == NULL) {
+		ESP_LOGE("DisplayUpdate", "Couldn't create staging buffer queues");
+
+		return false;
+	}
+
+	// Subscribe to the update messages of the master
+	const uint8_t messageIds[] = {CAN_MSG_PREPARE_UPDATE, CAN_MSG_TRANSMIT_UPDATE_FILE, CAN_MSG_EXECUTE_UPDATE};
+	if (!canDispatcherSubscribe(EVENT_BUS_CHANNEL_OF(CAN_UPDATE, CanMessage_t), messageIds, sizeof(messageIds),
+								CAN_SENDER_MASTER)) {
+		ESP_LOGE("DisplayUpdate", "Couldn't subscribe to CAN messages");
+
+		return false;
+	}
+
+	// Start the flash writer task
+	if (!taskTopologyCreate(TASK_UPDATE_FLASH_WRITER, flashWriterTask, NULL, NULL)) {
+		ESP_LOGE("DisplayUpdate", "Couldn't create flash writer task!");
 
 		return false;
 	}
 
 	// Start the can task
-	if (xTaskCreate(canTask, "CanUpdaterTask", 2048 * 4, NULL, 2, &g_taskHandle) != pdPASS) {
+	if (!taskTopologyCreate(TASK_UPDATE_MANAGER, canTask, NULL, NULL)) {
 		ESP_LOGE("DisplayUpdate", "Couldn't create can updater task!");
 
 		return false;
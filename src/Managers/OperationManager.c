@@ -1,11 +1,22 @@
 #include "Managers/OperationManager.h"
 
 // Project includes
+#include "AssetResidency.h"
 #include "Managers/CanUpdateManager.h"
+#include "GUI.h"
+#include "GuiStatistics.h"
+#include "LcdTransport.h"
+#include "Rgb565Swap.h"
 #include "Managers/RegistrationManager.h"
+#include "SensorSnapshot.h"
+#include "TaskTopology.h"
 #include "Version.h"
+#include "CanDispatcher.h"
 #include "can.h"
 
+// C includes
+#include <string.h>
+
 // espidf includes
 #include <esp_log.h>
 
@@ -13,14 +24,353 @@
 #include "freertos/FreeRTOS.h"
 
 /*
- *	Private variables
+ *	Private defines
  */
-//! \brief Task handle of the CAN task
-static TaskHandle_t g_taskHandle;
+//! \brief Diagnostic request of the render statistics. The can component has no id for it yet, so it uses the top of
+//! the message id range where it can't collide with the enumerated messages. The Sensor Board has to use the same id
+#define CAN_MSG_REQUEST_RENDER_STATISTICS 0xF0
+
+//! \brief Selects the SPI clock of the display from the next boot on. The request holds the clock in MHz in byte 1,
+//! the answer echoes it in byte 0 followed by 1 if it was stored
+#define CAN_MSG_SET_SPI_CLOCK_PROFILE 0xF1
+
+//! \brief Changes how much internal RAM the assets of the shown screen may occupy, 0 keeps them in flash. The request
+//! holds the budget in KiB big endian in bytes 1..2, the answer echoes it in bytes 0..1 followed by the resident bytes
+//! in bytes 2..4. A new budget restarts the timer handler and flush histograms, so reading the timer handler page a
+//! while after setting 0 and after setting the default budget shows what the copies gain
+#define CAN_MSG_SET_ASSET_BUDGET 0xF2
+
+//! \brief Diagnostic request of the statistics of one task. The request holds the TaskId_t in byte 1, the answer echoes
+//! it in byte 0 followed by the share of its core in percent since the previous request in byte 1, the CPU time since
+//! boot in ms in bytes 2..5 and the least free stack in bytes in bytes 6..7, all big endian
+#define CAN_MSG_REQUEST_TASK_STATISTICS 0xF3
+
+//! \brief Diagnostic request of the counters of one event bus channel. The request holds the EventChannel_t in byte 1,
+//! the answer echoes it in byte 0 followed by the depth in byte 1, the high-water mark in byte 2, the published events
+//! in bytes 3..5 and the overflows in bytes 6..7, all big endian. A high-water mark at the depth shows where events
+//! back up under load. The CAN driver fills CAN_RX directly, so neither its frames nor the frames it drops when CAN_RX
+//! is full are counted. Its high-water mark at the depth is the only sign of such drops
+#define CAN_MSG_REQUEST_EVENT_BUS_STATISTICS 0xF4
+
+//! \brief Diagnostic request of the counters of the CAN dispatcher. The answer holds the messages it dropped because a
+//! subscribed channel stayed full for its publish timeout in bytes 0..3, big endian. The overflows of the single
+//! channels in the 0xF4 answers tell which subscriber fell behind, for example CAN_UPDATE while an update is routed
+#define CAN_MSG_REQUEST_DISPATCHER_STATISTICS 0xF5
+
+//! \brief Pages of the render statistics answer. The request holds the page in byte 1, the answer in byte 0 followed
+//! by 7 bytes of big endian values
+#define RENDER_STATISTICS_PAGE_OVERVIEW 0 // [1..2] fps in tenths, [3..6] frames, [7] amount of pages
+#define RENDER_STATISTICS_PAGE_TRANSFER 1 // [1..4] KiB queued for SPI, [5..7] flushed areas
+#define RENDER_STATISTICS_PAGE_DROPPED 2 // [1..4] dropped sensor updates
+#define RENDER_STATISTICS_PAGE_TIMER_HANDLER 3 // [1..3] average us, [4..6] max us of lv_timer_handler()
+#define RENDER_STATISTICS_PAGE_FLUSH 4 // [1..3] average us, [4..6] max us of the flush callback
+#define RENDER_STATISTICS_PAGE_TIMER_HANDLER_HISTOGRAM 5 // [1..7] share of each bucket in percent
+#define RENDER_STATISTICS_PAGE_FLUSH_HISTOGRAM 6 // [1..7] share of each bucket in percent
+#define RENDER_STATISTICS_PAGE_SCREEN_SWITCH 7 // [1..3] last us, [4..6] max us, [7] amount of switches
+#define RENDER_STATISTICS_PAGE_LVGL_HEAP 8 // [1..3] internal bytes used, [4..6] internal peak, [7] fragmentation %
+#define RENDER_STATISTICS_PAGE_LVGL_HEAP_OVERFLOW 9 // [1..3] PSRAM bytes used, [4..6] PSRAM peak, [7] allocations
+#define RENDER_STATISTICS_PAGE_SPI 10 // [1..3] throughput KiB/s, [4..6] longest flush transfer us, [7] clock MHz
+#define RENDER_STATISTICS_PAGE_ROUND_MASK 11 // [1..3] bytes saved in the last frame, [4..7] KiB saved in total
+#define RENDER_STATISTICS_PAGE_ASSETS 12 // [1..3] resident bytes, [4..5] budget KiB, [6] loads, [7] evictions
+#define RENDER_STATISTICS_PAGE_FLUSH_OVERLAP 13 // Last frame: [1..3] transfer us, [4..6] stall us, [7] overlap %
+#define RENDER_STATISTICS_PAGE_PIXEL_SWAP 14 // [1] PIE kernel used, [2..4] kernel us, [5..7] word swap us per frame
+#define RENDER_STATISTICS_PAGE_AMOUNT 15
 
 /*
  *	Prototypes
  */
+//! \brief Writes a value big endian into a frame buffer, saturating if it doesn't fit
+//! \param p_buffer Where the value is written to
+//! \param value The value
+//! \param bytes Amount of bytes to use
+static void writeSaturated(uint8_t* p_buffer, uint64_t value, uint8_t bytes);
+
+//! \brief Writes the share of each histogram bucket in percent
+//! \param p_buffer Where the shares are written to
+//! \param p_histogram The histogram
+static void writeHistogram(uint8_t* p_buffer, const GuiDurationHistogram_t* p_histogram);
+
+//! \brief Writes the average and the maximum duration of a histogram
+//! \param p_buffer Where the durations are written to
+//! \param p_histogram The histogram
+static void writeDurations(uint8_t* p_buffer, const GuiDurationHistogram_t* p_histogram);
+
+//! \brief Answers a request of the render statistics
+//! \param p_message The request
+static void sendRenderStatistics(const CanMessage_t* p_message);
+
+//! \brief Stores the requested SPI clock profile and answers if it was accepted
+//! \param p_message The request
+static void setSpiClockProfile(const CanMessage_t* p_message);
+
+//! \brief Applies the requested asset budget and answers with the resulting usage
+//! \param p_message The request
+static void setAssetBudget(const CanMessage_t* p_message);
+
+//! \brief Answers a request of the task statistics
+//! \param p_message The request
+static void sendTaskStatistics(const CanMessage_t* p_message);
+
+//! \brief Answers a request of the event bus statistics
+//! \param p_message The request
+static void sendEventBusStatistics(const CanMessage_t* p_message);
+
+//! \brief Answers a request of the CAN dispatcher statistics
+static void sendDispatcherStatistics();
+
+/*
+ *	Private function implementations
+ */
+static void writeSaturated(uint8_t* p_buffer, uint64_t value, const uint8_t bytes)
+{
+	const uint64_t maxValue = bytes >= 8 ? UINT64_MAX : ((uint64_t)1 << (bytes * 8)) - 1;
+	if (value > maxValue) {
+		value = maxValue;
+	}
+
+	for (uint8_t i = 0; i < bytes; i++) {
+		p_buffer[i] = (uint8_t)(value >> ((bytes - 1 - i) * 8));
+	}
+}
+
+static void writeHistogram(uint8_t* p_buffer, const GuiDurationHistogram_t* p_histogram)
+{
+	for (uint8_t i = 0; i < GUI_HISTOGRAM_BUCKETS; i++) {
+		p_buffer[i] = p_histogram->samples == 0
+						  ? 0
+						  : (uint8_t)((uint64_t)p_histogram->buckets[i] * 100 / p_histogram->samples);
+	}
+}
+
+static void writeDurations(uint8_t* p_buffer, const GuiDurationHistogram_t* p_histogram)
+{
+	const uint64_t averageUs = p_histogram->samples == 0 ? 0 : p_histogram->totalUs / p_histogram->samples;
+	writeSaturated(&p_buffer[0], averageUs, 3);
+	writeSaturated(&p_buffer[3], p_histogram->maxUs, 3);
+}
+
+static void sendRenderStatistics(const CanMessage_t* p_message)
+{
+	// Without a page the overview is sent
+	const uint8_t page = p_message->dlc > 1 ? p_message->buffer[1] : RENDER_STATISTICS_PAGE_OVERVIEW;
+	if (page >= RENDER_STATISTICS_PAGE_AMOUNT) {
+		ESP_LOGW("OperationManager", "Render statistics page %d doesn't exist", page);
+		return;
+	}
+
+	GuiRenderStatistics_t statistics;
+	guiStatisticsGet(&statistics);
+
+	LcdTransportStatistics_t transportStatistics;
+	lcdTransportGetStatistics(&transportStatistics);
+
+	AssetResidencyStatistics_t assetStatistics;
+	assetResidencyGetStatistics(&assetStatistics);
+
+	GuiFlushStatistics_t flushStatistics;
+	guiGetFlushStatistics(&flushStatistics);
+
+	Rgb565SwapStatistics_t swapStatistics;
+	rgb565SwapGetStatistics(&swapStatistics);
+
+	// Create the CAN answer frame
+	TwaiFrame_t frame;
+	memset(frame.buffer, 0, sizeof(frame.buffer));
+	frame.buffer[0] = page;
+
+	// Set the buffer content
+	switch (page) {
+		case RENDER_STATISTICS_PAGE_OVERVIEW:
+			writeSaturated(&frame.buffer[1], statistics.fpsTenths, 2);
+			writeSaturated(&frame.buffer[3], statistics.frames, 4);
+			frame.buffer[7] = RENDER_STATISTICS_PAGE_AMOUNT;
+			break;
+		case RENDER_STATISTICS_PAGE_TRANSFER:
+			writeSaturated(&frame.buffer[1], statistics.spiBytes / 1024, 4);
+			writeSaturated(&frame.buffer[5], statistics.flushedAreas, 3);
+			break;
+		case RENDER_STATISTICS_PAGE_DROPPED:
+			writeSaturated(&frame.buffer[1], statistics.droppedSensorUpdates, 4);
+			break;
+		case RENDER_STATISTICS_PAGE_TIMER_HANDLER:
+			writeDurations(&frame.buffer[1], &statistics.timerHandler);
+			break;
+		case RENDER_STATISTICS_PAGE_FLUSH:
+			writeDurations(&frame.buffer[1], &statistics.flush);
+			break;
+		case RENDER_STATISTICS_PAGE_TIMER_HANDLER_HISTOGRAM:
+			writeHistogram(&frame.buffer[1], &statistics.timerHandler);
+			break;
+		case RENDER_STATISTICS_PAGE_FLUSH_HISTOGRAM:
+			writeHistogram(&frame.buffer[1], &statistics.flush);
+			break;
+		case RENDER_STATISTICS_PAGE_SCREEN_SWITCH:
+			writeSaturated(&frame.buffer[1], statistics.lastScreenSwitchUs, 3);
+			writeSaturated(&frame.buffer[4], statistics.maxScreenSwitchUs, 3);
+			writeSaturated(&frame.buffer[7], statistics.screenSwitches, 1);
+			break;
+		case RENDER_STATISTICS_PAGE_LVGL_HEAP:
+			writeSaturated(&frame.buffer[1], statistics.lvglHeap.internalUsedB, 3);
+			writeSaturated(&frame.buffer[4], statistics.lvglHeap.internalPeakB, 3);
+			frame.buffer[7] = statistics.lvglHeap.fragmentationPercent;
+			break;
+		case RENDER_STATISTICS_PAGE_LVGL_HEAP_OVERFLOW:
+			writeSaturated(&frame.buffer[1], statistics.lvglHeap.overflowUsedB, 3);
+			writeSaturated(&frame.buffer[4], statistics.lvglHeap.overflowPeakB, 3);
+			writeSaturated(&frame.buffer[7], statistics.lvglHeap.overflowAllocations, 1);
+			break;
+		case RENDER_STATISTICS_PAGE_SPI:
+			writeSaturated(&frame.buffer[1], transportStatistics.throughputKiBps, 3);
+			writeSaturated(&frame.buffer[4], transportStatistics.maxTransferUs, 3);
+			frame.buffer[7] = transportStatistics.clockMhz;
+			break;
+		case RENDER_STATISTICS_PAGE_ROUND_MASK:
+			writeSaturated(&frame.buffer[1], statistics.lastFrameSpiBytesSaved, 3);
+			writeSaturated(&frame.buffer[4], statistics.spiBytesSaved / 1024, 4);
+			break;
+		case RENDER_STATISTICS_PAGE_ASSETS:
+			writeSaturated(&frame.buffer[1], assetStatistics.residentB, 3);
+			writeSaturated(&frame.buffer[4], assetStatistics.budgetB / 1024, 2);
+			writeSaturated(&frame.buffer[6], assetStatistics.loads, 1);
+			writeSaturated(&frame.buffer[7], assetStatistics.evictions, 1);
+			break;
+		case RENDER_STATISTICS_PAGE_FLUSH_OVERLAP:
+			writeSaturated(&frame.buffer[1], flushStatistics.transferUs, 3);
+			writeSaturated(&frame.buffer[4], flushStatistics.stallUs, 3);
+			frame.buffer[7] = flushStatistics.overlapPercent;
+			break;
+		case RENDER_STATISTICS_PAGE_PIXEL_SWAP:
+			frame.buffer[1] = (uint8_t)swapStatistics.vectorKernel;
+			writeSaturated(&frame.buffer[2], swapStatistics.kernelFrameUs, 3);
+			writeSaturated(&frame.buffer[5], swapStatistics.wordFrameUs, 3);
+			break;
+		default:
+			break;
+	}
+
+	// Initiate the frame
+	canInitiateFrame(&frame, CAN_MSG_REQUEST_RENDER_STATISTICS, 8);
+
+	// Send the frame
+	canQueueFrame(&frame);
+}
+
+static void setSpiClockProfile(const CanMessage_t* p_message)
+{
+	if (p_message->dlc < 2) {
+		ESP_LOGW("OperationManager", "SPI clock profile request without a clock");
+		return;
+	}
+
+	// Takes effect after the next restart, the panel can't be re-clocked while LVGL is drawing
+	const uint8_t clockMhz = p_message->buffer[1];
+	const bool stored = lcdTransportStoreClockProfile(clockMhz);
+
+	// Create the CAN answer frame
+	TwaiFrame_t frame;
+	memset(frame.buffer, 0, sizeof(frame.buffer));
+	frame.buffer[0] = clockMhz;
+	frame.buffer[1] = stored ? 1 : 0;
+
+	// Initiate the frame
+	canInitiateFrame(&frame, CAN_MSG_SET_SPI_CLOCK_PROFILE, 2);
+
+	// Send the frame
+	canQueueFrame(&frame);
+}
+
+static void setAssetBudget(const CanMessage_t* p_message)
+{
+	if (p_message->dlc < 3) {
+		ESP_LOGW("OperationManager", "Asset budget request without a budget");
+		return;
+	}
+
+	const uint16_t budgetKiB = (uint16_t)(p_message->buffer[1] << 8 | p_message->buffer[2]);
+	guiSetAssetResidencyBudget((uint32_t)budgetKiB * 1024);
+
+	AssetResidencyStatistics_t statistics;
+	assetResidencyGetStatistics(&statistics);
+
+	// Create the CAN answer frame
+	TwaiFrame_t frame;
+	memset(frame.buffer, 0, sizeof(frame.buffer));
+	writeSaturated(&frame.buffer[0], budgetKiB, 2);
+	writeSaturated(&frame.buffer[2], statistics.residentB, 3);
+
+	// Initiate the frame
+	canInitiateFrame(&frame, CAN_MSG_SET_ASSET_BUDGET, 5);
+
+	// Send the frame
+	canQueueFrame(&frame);
+}
+
+static void sendTaskStatistics(const CanMessage_t* p_message)
+{
+	if (p_message->dlc < 2 || p_message->buffer[1] >= TASK_AMOUNT) {
+		ESP_LOGW("OperationManager", "Task statistics request without a valid task");
+		return;
+	}
+
+	const TaskId_t task = (TaskId_t)p_message->buffer[1];
+	TaskStatistics_t statistics;
+	taskTopologyGetStatistics(task, &statistics);
+
+	// Create the CAN answer frame, all zero if the task doesn't exist
+	TwaiFrame_t frame;
+	memset(frame.buffer, 0, sizeof(frame.buffer));
+	frame.buffer[0] = (uint8_t)task;
+	frame.buffer[1] = statistics.cpuPercent;
+	writeSaturated(&frame.buffer[2], statistics.runTimeUs / 1000, 4);
+	writeSaturated(&frame.buffer[6], statistics.stackHighWaterB, 2);
+
+	// Initiate the frame
+	canInitiateFrame(&frame, CAN_MSG_REQUEST_TASK_STATISTICS, 8);
+
+	// Send the frame
+	canQueueFrame(&frame);
+}
+
+static void sendEventBusStatistics(const CanMessage_t* p_message)
+{
+	if (p_message->dlc < 2 || p_message->buffer[1] >= EVENT_CHANNEL_AMOUNT) {
+		ESP_LOGW("OperationManager", "Event bus statistics request without a valid channel");
+		return;
+	}
+
+	const EventChannel_t channel = (EventChannel_t)p_message->buffer[1];
+	EventBusStatistics_t statistics;
+	eventBusGetStatistics(channel, &statistics);
+
+	// Create the CAN answer frame
+	TwaiFrame_t frame;
+	memset(frame.buffer, 0, sizeof(frame.buffer));
+	frame.buffer[0] = (uint8_t)channel;
+	writeSaturated(&frame.buffer[1], statistics.depth, 1);
+	writeSaturated(&frame.buffer[2], statistics.highWater, 1);
+	writeSaturated(&frame.buffer[3], statistics.published, 3);
+	writeSaturated(&frame.buffer[6], statistics.overflows, 2);
+
+	// Initiate the frame
+	canInitiateFrame(&frame, CAN_MSG_REQUEST_EVENT_BUS_STATISTICS, 8);
+
+	// Send the frame
+	canQueueFrame(&frame);
+}
+
+static void sendDispatcherStatistics()
+{
+	// Create the CAN answer frame
+	TwaiFrame_t frame;
+	memset(frame.buffer, 0, sizeof(frame.buffer));
+	writeSaturated(&frame.buffer[0], canDispatcherGetDroppedCount(), 4);
+
+	// Initiate the frame
+	canInitiateFrame(&frame, CAN_MSG_REQUEST_DISPATCHER_STATISTICS, 4);
+
+	// Send the frame
+	canQueueFrame(&frame);
+}
 
 /*
  *	Tasks
@@ -29,37 +379,27 @@ static TaskHandle_t g_taskHandle;
 //! \param p_param Unused parameters
 static void canTask(void* p_param)
 {
-	// Wait for new queue events
-	TwaiFrame_t rxFrame;
+	// Wait for new queue events. The dispatcher only delivers our messages of the master
+	CanMessage_t message;
 	while (true) {
 		// Wait until we get a new event in the queue
-		if (xQueueReceive(g_operationManagerCanQueue, &rxFrame, portMAX_DELAY) != pdPASS) {
-			continue;
-		}
-
-		// Skip if it's not from the master
-		if ((rxFrame.espidfFrame.header.id & 0x1FFFFF) != 0) {
+		if (!EVENT_BUS_RECEIVE(OPERATION, &message, portMAX_DELAY)) {
 			continue;
 		}
 
 		// Get the frame id
-		const uint8_t frameId = rxFrame.espidfFrame.header.id >> CAN_FRAME_ID_OFFSET;
+		const uint8_t frameId = message.messageId;
 
 		/*
 		 *	Broadcasts
 		 */
 		// New sensor data
 		if (frameId == CAN_MSG_SENSOR_DATA) {
-			// Create the event
-			QueueEvent_t event;
-			event.command = NEW_SENSOR_DATA;
-			memcpy(event.frameBuffer, rxFrame.buffer, CAN_FRAME_MAX_BUFFER_LENGTH_B);
-			event.frameDlc = rxFrame.espidfFrame.header.dlc;
-			event.frameId = rxFrame.espidfFrame.header.id;
+			// Overwrite the latest sensor data, the GUI only ever shows the newest values
+			sensorSnapshotPublish(message.buffer, message.dlc);
 
-
-			// Queue the event
-			xQueueSend(g_guiEventQueue, &event, pdMS_TO_TICKS(100));
+			// Let the GUI render them
+			guiNotifyNewSensorData();
 			continue;
 		}
 
@@ -67,8 +407,7 @@ static void canTask(void* p_param)
 		 *	Com id specific frames
 		 */
 		// Skip if we were not meant
-		if (rxFrame.espidfFrame.header.dlc == 0 ||
-			(rxFrame.espidfFrame.header.dlc > 0 && *rxFrame.buffer != g_ownCanComId)) {
+		if (message.dlc == 0 || (message.dlc > 0 && *message.buffer != g_ownCanComId)) {
 			continue;
 		}
 
@@ -117,6 +456,42 @@ static void canTask(void* p_param)
 			ESP_LOGI("OperationManager", "Send hash information to the Sensor Board!");
 			continue;
 		}
+
+		// Diagnostic request of the render statistics
+		if (frameId == CAN_MSG_REQUEST_RENDER_STATISTICS) {
+			sendRenderStatistics(&message);
+			continue;
+		}
+
+		// Selection of the SPI clock of the display
+		if (frameId == CAN_MSG_SET_SPI_CLOCK_PROFILE) {
+			setSpiClockProfile(&message);
+			continue;
+		}
+
+		// Budget of the asset copies in internal RAM
+		if (frameId == CAN_MSG_SET_ASSET_BUDGET) {
+			setAssetBudget(&message);
+			continue;
+		}
+
+		// Diagnostic request of the task statistics
+		if (frameId == CAN_MSG_REQUEST_TASK_STATISTICS) {
+			sendTaskStatistics(&message);
+			continue;
+		}
+
+		// Diagnostic request of the event bus statistics
+		if (frameId == CAN_MSG_REQUEST_EVENT_BUS_STATISTICS) {
+			sendEventBusStatistics(&message);
+			continue;
+		}
+
+		// Diagnostic request of the CAN dispatcher statistics
+		if (frameId == CAN_MSG_REQUEST_DISPATCHER_STATISTICS) {
+			sendDispatcherStatistics();
+			continue;
+		}
 	}
 }
 
@@ -125,15 +500,21 @@ static void canTask(void* p_param)
  */
 bool operationManagerInit()
 {
-	// Register to the CAN rx cb
-	if (!canRegisterRxCbQueue(&g_operationManagerCanQueue)) {
-		ESP_LOGE("OperationManager", "Couldn't register rx cb queue");
+	// Subscribe to the operation messages of the master
+	const uint8_t messageIds[] = {CAN_MSG_SENSOR_DATA, CAN_MSG_REQUEST_FIRMWARE_VERSION,
+								  CAN_MSG_REQUEST_COMMIT_INFORMATION, CAN_MSG_REQUEST_RENDER_STATISTICS,
+								  CAN_MSG_SET_SPI_CLOCK_PROFILE, CAN_MSG_SET_ASSET_BUDGET,
+								  CAN_MSG_REQUEST_TASK_STATISTICS, CAN_MSG_REQUEST_EVENT_BUS_STATISTICS,
+								  CAN_MSG_REQUEST_DISPATCHER_STATISTICS};
+	if (!canDispatcherSubscribe(EVENT_BUS_CHANNEL_OF(OPERATION, CanMessage_t), messageIds, sizeof(messageIds),
+								CAN_SENDER_MASTER)) {
+		ESP_LOGE("OperationManager", "Couldn't subscribe to CAN messages");
 
 		return false;
 	}
 
 	// Start the can task
-	if (xTaskCreate(canTask, "OperationManagerCanTask", 2048 * 4, NULL, 0, &g_taskHandle) != pdPASS) {
+	if (!taskTopologyCreate(TASK_OPERATION_MANAGER, canTask, NULL, NULL)) {
 		ESP_LOGE("OperationManager", "Couldn't create CAN task!");
 
 		return false;
@@ -150,9 +531,9 @@ bool operationManagerInit()
 
 void operationManagerDestroy()
 {
-	// Unregister from the CAN rx cb
-	canUnregisterRxCbQueue(&g_operationManagerCanQueue);
+	// Unsubscribe from the CAN messages
+	canDispatcherUnsubscribe(EVENT_CHANNEL_OPERATION);
 
 	// Destroy the CAN task
-	vTaskDelete(g_taskHandle);
+	taskTopologyDelete(TASK_OPERATION_MANAGER);
 }
@@ -2,6 +2,8 @@
 
 // Project includes
 #include "Managers/OperationManager.h"
+#include "CanDispatcher.h"
+#include "TaskTopology.h"
 #include "can.h"
 
 // espidf includes
@@ -33,9 +35,6 @@ uint8_t g_ownCanComId = 0;
 /*
  *	Private variables
  */
-//! \brief Task handle of the CAN task
-static TaskHandle_t g_taskHandle;
-
 // The MAC address
 static uint8_t g_macAddress[MAC_ADDRESS_LENGTH];
 
@@ -46,21 +45,16 @@ static uint8_t g_macAddress[MAC_ADDRESS_LENGTH];
 //! \param p_param Unused parameters
 static void canTask(void* p_param)
 {
-	// Wait for new queue events
-	TwaiFrame_t rxFrame;
+	// Wait for new queue events. The dispatcher only delivers our messages of the master
+	CanMessage_t message;
 	while (true) {
 		// Wait until we get a new event in the queue
-		if (xQueueReceive(g_registrationManagerQueue, &rxFrame, portMAX_DELAY) != pdPASS) {
-			continue;
-		}
-
-		// Skip if it's not from the master
-		if ((rxFrame.espidfFrame.header.id & 0x1FFFFF) != 0) {
+		if (!EVENT_BUS_RECEIVE(REGISTRATION, &message, portMAX_DELAY)) {
 			continue;
 		}
 
 		// Get the frame id
-		const uint8_t frameId = rxFrame.espidfFrame.header.id >> CAN_FRAME_ID_OFFSET;
+		const uint8_t frameId = message.messageId;
 
 		/*
 		 *	Broadcasts
@@ -76,18 +70,18 @@ static void canTask(void* p_param)
 		// Was it a new ID?
 		if (frameId == CAN_MSG_COMID_ASSIGNATION) {
 			// Check if the HW UUID matches
-			if (rxFrame.espidfFrame.header.dlc < 7 || !doesMacMatch(rxFrame.buffer)) {
+			if (message.dlc < 7 || !doesMacMatch(message.buffer)) {
 				continue;
 			}
 
 			// Save the new ID
-			g_ownCanComId = rxFrame.buffer[6];
+			g_ownCanComId = message.buffer[6];
 
 			// Get the screen type
-			const uint8_t screen = rxFrame.buffer[7];
+			const uint8_t screen = message.buffer[7];
 
 			// Display the screen
-			QueueEvent_t event;
+			GuiEvent_t event;
 			if (screen == SCREEN_TEMPERATURE) {
 				event.command = DISPLAY_TEMPERATURE_SCREEN;
 			}
@@ -99,7 +93,7 @@ static void canTask(void* p_param)
 			else {
 				event.command = DISPLAY_RPM_SCREEN;
 			}
-			xQueueSend(g_guiEventQueue, &event, portMAX_DELAY);
+			EVENT_BUS_PUBLISH(GUI, &event, portMAX_DELAY);
 
 			// Logging
 			ESP_LOGI("RegistrationManager", "Finished registration. Entering operation mode");
@@ -108,7 +102,7 @@ static void canTask(void* p_param)
 			operationManagerInit();
 
 			// Delete the task
-			vTaskDelete(NULL);
+			taskTopologyDelete(TASK_REGISTRATION_MANAGER);
 
 			continue;
 		}
@@ -173,15 +167,17 @@ bool registrationManagerInit()
 	// Get the MAC address
 	pullMacAddress();
 
-	// Register to the CAN rx cb
-	if (!canRegisterRxCbQueue(&g_registrationManagerQueue)) {
-		ESP_LOGE("RegistrationManager", "Couldn't register rx cb queue");
+	// Subscribe to the registration messages of the master
+	const uint8_t messageIds[] = {CAN_MSG_REGISTRATION, CAN_MSG_COMID_ASSIGNATION};
+	if (!canDispatcherSubscribe(EVENT_BUS_CHANNEL_OF(REGISTRATION, CanMessage_t), messageIds, sizeof(messageIds),
+								CAN_SENDER_MASTER)) {
+		ESP_LOGE("RegistrationManager", "Couldn't subscribe to CAN messages");
 
 		return false;
 	}
 
 	// Start the can task
-	if (xTaskCreate(canTask, "RegistrationManagerCanTask", 2048 * 4, NULL, 0, &g_taskHandle) != pdPASS) {
+	if (!taskTopologyCreate(TASK_REGISTRATION_MANAGER, canTask, NULL, NULL)) {
 		ESP_LOGE("RegistrationManager", "Couldn't create CAN task!");
 
 		return false;
@@ -195,6 +191,6 @@ bool registrationManagerInit()
 
 void registrationManagerDestroy()
 {
-	// Unregister from the CAN rx cb
-	canUnregisterRxCbQueue(&g_registrationManagerQueue);
+	// Unsubscribe from the CAN messages
+	canDispatcherUnsubscribe(EVENT_CHANNEL_REGISTRATION);
 }
@@ -0,0 +1,220 @@
+#include "Rgb565Swap.h"
+
+// C includes
+#include <stddef.h>
+#include <string.h>
+
+// espidf includes
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#if defined(ESP_PLATFORM)
+#include "sdkconfig.h"
+#endif
+
+/*
+ *	Private defines
+ */
+//! \brief The PIE of the ESP32-S3 loads and stores 16 byte aligned vectors
+#if CONFIG_IDF_TARGET_ESP32S3
+#define RGB565_SWAP_HAS_PIE 1
+#else
+#define RGB565_SWAP_HAS_PIE 0
+#endif
+
+//! \brief Pixels one iteration of the block kernels swaps, two 16 byte vectors
+#define BLOCK_PX 16
+
+//! \brief Alignment the block kernels need in bytes
+#define BLOCK_ALIGN_B 16
+
+//! \brief Pixels of the self-check buffer, a few blocks plus every possible misalignment
+#define CHECK_PX (BLOCK_PX * 8 + BLOCK_ALIGN_B / 2)
+
+//! \brief Pixels of the measurement, a full frame of the panel
+#define MEASUREMENT_PX (240 * 240)
+
+/*
+ *	Private typedefs
+ */
+//! \brief Swaps whole blocks of BLOCK_PX pixels
+//! \param p_pixels The pixels, BLOCK_ALIGN_B aligned
+//! \param blockAmount Amount of blocks
+typedef void (*SwapBlocksFunction_t)(uint16_t* p_pixels, uint32_t blockAmount);
+
+/*
+ *	Prototypes
+ */
+//! \brief Swaps whole blocks word wise, used where the PIE kernel isn't available or failed its check
+//! \param p_pixels The pixels, BLOCK_ALIGN_B aligned
+//! \param blockAmount Amount of blocks
+static void swapBlocksPortable(uint16_t* p_pixels, uint32_t blockAmount);
+
+#if RGB565_SWAP_HAS_PIE
+//! \brief Swaps whole blocks with the PIE, see Rgb565SwapPie.S
+//! \param p_pixels The pixels, BLOCK_ALIGN_B aligned
+//! \param blockAmount Amount of blocks
+extern void rgb565SwapBlocksPie(uint16_t* p_pixels, uint32_t blockAmount);
+
+//! \brief Checks a block kernel against the reference on every alignment and a few lengths
+//! \param swapBlocks The kernel
+//! \retval Bool indicating if it swapped everything correctly
+static bool checkKernel(SwapBlocksFunction_t swapBlocks);
+
+//! \brief Measures how long swapping a frame takes
+//! \param swap The swap function
+//! \param p_pixels Buffer of MEASUREMENT_PX pixels
+//! \retval The time in us
+static uint32_t measureFrameUs(void (*swap)(uint16_t*, uint32_t), uint16_t* p_pixels);
+#endif
+
+/*
+ *	Private variables
+ */
+//! \brief The block kernel rgb565Swap() uses
+static SwapBlocksFunction_t g_swapBlocks = swapBlocksPortable;
+
+static Rgb565SwapStatistics_t g_statistics = {0};
+
+/*
+ *	Private function implementations
+ */
+static void swapBlocksPortable(uint16_t* p_pixels, const uint32_t blockAmount)
+{
+	rgb565SwapWords(p_pixels, blockAmount * BLOCK_PX);
+}
+
+#if RGB565_SWAP_HAS_PIE
+static bool checkKernel(const SwapBlocksFunction_t swapBlocks)
+{
+	static uint16_t s_expected[CHECK_PX] __attribute__((aligned(BLOCK_ALIGN_B)));
+	static uint16_t s_actual[CHECK_PX] __attribute__((aligned(BLOCK_ALIGN_B)));
+
+	const SwapBlocksFunction_t previous = g_swapBlocks;
+	g_swapBlocks = swapBlocks;
+
+	// Every start within a vector and lengths around the block size, so the head, the blocks and the tail are covered
+	bool correct = true;
+	for (uint32_t startPx = 0; startPx < BLOCK_ALIGN_B / 2 && correct; startPx++) {
+		for (uint32_t lengthPx = 0; startPx + lengthPx <= CHECK_PX && correct; lengthPx += 7) {
+			for (uint32_t i = 0; i < CHECK_PX; i++) {
+				s_expected[i] = (uint16_t)(i * 0x9E37 + startPx * 0x0101 + 0x1234);
+			}
+			memcpy(s_actual, s_expected, sizeof(s_actual));
+
+			rgb565SwapReference(&s_expected[startPx], lengthPx);
+			rgb565Swap(&s_actual[startPx], lengthPx);
+			correct = memcmp(s_expected, s_actual, sizeof(s_actual)) == 0;
+		}
+	}
+
+	g_swapBlocks = previous;
+
+	return correct;
+}
+
+static uint32_t measureFrameUs(void (*swap)(uint16_t*, uint32_t), uint16_t* p_pixels)
+{
+	const int64_t startUs = esp_timer_get_time();
+	swap(p_pixels, MEASUREMENT_PX);
+
+	return (uint32_t)(esp_timer_get_time() - startUs);
+}
+#endif
+
+/*
+ *	Public function implementations
+ */
+bool rgb565SwapInit()
+{
+#if RGB565_SWAP_HAS_PIE
+	if (!checkKernel(rgb565SwapBlocksPie)) {
+		ESP_LOGE("Rgb565Swap", "PIE kernel swapped wrong, using the portable one");
+
+		return false;
+	}
+	g_swapBlocks = rgb565SwapBlocksPie;
+	g_statistics.vectorKernel = true;
+
+	// Measured in the internal RAM the frame buffers live in. Without it, the check alone has to do
+	uint16_t* p_pixels = heap_caps_malloc(MEASUREMENT_PX * sizeof(uint16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (p_pixels != NULL) {
+		memset(p_pixels, 0x5A, MEASUREMENT_PX * sizeof(uint16_t));
+		g_statistics.wordFrameUs = measureFrameUs(rgb565SwapWords, p_pixels);
+		g_statistics.kernelFrameUs = measureFrameUs(rgb565Swap, p_pixels);
+		heap_caps_free(p_pixels);
+
+		ESP_LOGI("Rgb565Swap", "Swapping a frame takes %lu us with the PIE, %lu us word wise",
+				 (unsigned long)g_statistics.kernelFrameUs, (unsigned long)g_statistics.wordFrameUs);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void rgb565Swap(uint16_t* p_pixels, uint32_t pixelAmount)
+{
+	// Pixel by pixel until the vectors are aligned
+	while (pixelAmount > 0 && ((uintptr_t)p_pixels & (BLOCK_ALIGN_B - 1)) != 0) {
+		*p_pixels = (uint16_t)((*p_pixels << 8) | (*p_pixels >> 8));
+		p_pixels++;
+		pixelAmount--;
+	}
+
+	const uint32_t blockAmount = pixelAmount / BLOCK_PX;
+	if (blockAmount > 0) {
+		g_swapBlocks(p_pixels, blockAmount);
+		p_pixels += blockAmount * BLOCK_PX;
+		pixelAmount -= blockAmount * BLOCK_PX;
+	}
+
+	rgb565SwapReference(p_pixels, pixelAmount);
+}
+
+void rgb565SwapReference(uint16_t* p_pixels, const uint32_t pixelAmount)
+{
+	for (uint32_t i = 0; i < pixelAmount; i++) {
+		p_pixels[i] = (uint16_t)((p_pixels[i] << 8) | (p_pixels[i] >> 8));
+	}
+}
+
+void rgb565SwapWords(uint16_t* p_pixels, uint32_t pixelAmount)
+{
+	// A single pixel first if the words wouldn't be aligned
+	if (pixelAmount > 0 && ((uintptr_t)p_pixels & 0x3) != 0) {
+		rgb565SwapReference(p_pixels, 1);
+		p_pixels++;
+		pixelAmount--;
+	}
+
+	uint32_t* p_words = (uint32_t*)p_pixels;
+	uint32_t wordAmount = pixelAmount / 2;
+	while (wordAmount >= 8) {
+		for (uint8_t i = 0; i < 8; i++) {
+			p_words[i] = ((p_words[i] & 0xFF00FF00) >> 8) | ((p_words[i] & 0x00FF00FF) << 8);
+		}
+		p_words += 8;
+		wordAmount -= 8;
+	}
+	while (wordAmount > 0) {
+		*p_words = ((*p_words & 0xFF00FF00) >> 8) | ((*p_words & 0x00FF00FF) << 8);
+		p_words++;
+		wordAmount--;
+	}
+
+	if ((pixelAmount & 0x1) != 0) {
+		rgb565SwapReference((uint16_t*)p_words, 1);
+	}
+}
+
+void rgb565SwapGetStatistics(Rgb565SwapStatistics_t* p_statistics)
+{
+	if (p_statistics == NULL) {
+		return;
+	}
+
+	*p_statistics = g_statistics;
+}
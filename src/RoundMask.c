@@ -0,0 +1,264 @@
+#include "RoundMask.h"
+
+// C includes
+#include <string.h>
+
+/*
+ *	Private defines
+ */
+//! \brief What another window costs in bytes on the bus. Setting the column and row window takes three commands,
+//! and esp_lcd waits for the previous transfer to finish before it sends them. ROUND_MASK_MAX_WINDOWS bounds the
+//! blocking that causes
+#define WINDOW_OVERHEAD_B 256
+
+/*
+ *	Prototypes
+ */
+//! \brief Returns the visible part of a row within a column range
+//! \param y The row
+//! \param x1 First column
+//! \param x2 Last column
+//! \param p_start Where the first visible column is written to
+//! \param p_end Where the last visible column is written to
+//! \retval Bool indicating if anything of the row is visible
+static bool getVisibleSpan(int32_t y, int32_t x1, int32_t x2, int32_t* p_start, int32_t* p_end);
+
+//! \brief Checks if anything of a row of an area is visible
+//! \param p_area The area
+//! \param y The row
+//! \retval Bool indicating if the row is visible
+static bool isRowVisible(const lv_area_t* p_area, int32_t y);
+
+//! \brief Finds the cheapest split of an area into windows of consecutive visible rows. A window costs the bytes of
+//! its bounding box plus the overhead, so rows with similar spans end up sharing one
+//! \param p_area The area
+//! \param bytesPerPixel Size of one pixel in bytes
+//! \param overheadB What setting up a window costs in bytes
+//! \retval Amount of windows of the split, it is stored in g_windowStart
+static uint8_t findWindows(const lv_area_t* p_area, uint8_t bytesPerPixel, uint32_t overheadB);
+
+/*
+ *	Private variables
+ */
+//! \brief First and last visible column of every row
+static int16_t g_spanStart[ROUND_MASK_MAX_DIAMETER];
+static int16_t g_spanEnd[ROUND_MASK_MAX_DIAMETER];
+static uint16_t g_diameter = 0;
+
+//! \brief Cheapest cost of sending the first n rows of the area and the first row of the last window of it. Only used
+//! from the flush callback, so they don't have to live on its stack
+static uint32_t g_cost[ROUND_MASK_MAX_DIAMETER + 1];
+static int16_t g_windowStart[ROUND_MASK_MAX_DIAMETER + 1];
+
+/*
+ *	Private function implementations
+ */
+static bool getVisibleSpan(const int32_t y, const int32_t x1, const int32_t x2, int32_t* p_start, int32_t* p_end)
+{
+	if (y < 0 || y >= g_diameter) {
+		return false;
+	}
+
+	*p_start = x1 > g_spanStart[y] ? x1 : g_spanStart[y];
+	*p_end = x2 < g_spanEnd[y] ? x2 : g_spanEnd[y];
+	return *p_start <= *p_end;
+}
+
+static bool isRowVisible(const lv_area_t* p_area, const int32_t y)
+{
+	int32_t start = 0;
+	int32_t end = 0;
+	return getVisibleSpan(y, p_area->x1, p_area->x2, &start, &end);
+}
+
+static uint8_t findWindows(const lv_area_t* p_area, const uint8_t bytesPerPixel, const uint32_t overheadB)
+{
+	const int32_t rows = lv_area_get_height(p_area);
+
+	g_cost[0] = 0;
+	for (int32_t end = 1; end <= rows; end++) {
+		// Invisible rows are skipped for free, no window may contain them
+		if (!isRowVisible(p_area, p_area->y1 + end - 1)) {
+			g_cost[end] = g_cost[end - 1];
+			g_windowStart[end] = (int16_t)(end - 1);
+			continue;
+		}
+
+		// Try every window ending with this row, growing it upwards
+		g_cost[end] = UINT32_MAX;
+		int32_t x1 = INT32_MAX;
+		int32_t x2 = INT32_MIN;
+		for (int32_t start = end - 1; start >= 0; start--) {
+			int32_t spanStart = 0;
+			int32_t spanEnd = 0;
+			if (!getVisibleSpan(p_area->y1 + start, p_area->x1, p_area->x2, &spanStart, &spanEnd)) {
+				break;
+			}
+			x1 = spanStart < x1 ? spanStart : x1;
+			x2 = spanEnd > x2 ? spanEnd : x2;
+
+			// The window only gets bigger from here on
+			const uint32_t windowCostB = (uint32_t)((x2 - x1 + 1) * (end - start)) * bytesPerPixel + overheadB;
+			if (windowCostB >= g_cost[end]) {
+				break;
+			}
+
+			if (g_cost[start] + windowCostB < g_cost[end]) {
+				g_cost[end] = g_cost[start] + windowCostB;
+				g_windowStart[end] = (int16_t)start;
+			}
+		}
+	}
+
+	// Count the windows of the split
+	uint8_t amount = 0;
+	for (int32_t end = rows; end > 0; end = g_windowStart[end]) {
+		if (g_windowStart[end] != end - 1 || isRowVisible(p_area, p_area->y1 + end - 1)) {
+			amount = amount < UINT8_MAX ? amount + 1 : amount;
+		}
+	}
+
+	return amount;
+}
+
+/*
+ *	Public function implementations
+ */
+bool roundMaskInit(const uint16_t diameter)
+{
+	if (diameter == 0 || diameter > ROUND_MASK_MAX_DIAMETER) {
+		return false;
+	}
+
+	// A pixel is visible if its center is within the circle. In doubled coordinates everything stays integer
+	const int32_t radiusSquared = (int32_t)diameter * diameter;
+	for (int32_t y = 0; y < diameter; y++) {
+		const int32_t dy = 2 * y - (diameter - 1);
+		int32_t x = 0;
+		while (x < diameter / 2 && (2 * x - (diameter - 1)) * (2 * x - (diameter - 1)) + dy * dy > radiusSquared) {
+			x++;
+		}
+
+		// Symmetric, the span ends where it starts from the other side
+		g_spanStart[y] = (int16_t)x;
+		g_spanEnd[y] = (int16_t)(diameter - 1 - x);
+	}
+
+	g_diameter = diameter;
+	return true;
+}
+
+void roundMaskClipArea(lv_area_t* p_area)
+{
+	if (g_diameter == 0) {
+		return;
+	}
+
+	// Drop the rows at the top and the bottom which are completely outside the circle
+	int32_t start = 0;
+	int32_t end = 0;
+	int32_t y1 = p_area->y1;
+	int32_t y2 = p_area->y2;
+	while (y1 <= y2 && !getVisibleSpan(y1, p_area->x1, p_area->x2, &start, &end)) {
+		y1++;
+	}
+	while (y2 > y1 && !getVisibleSpan(y2, p_area->x1, p_area->x2, &start, &end)) {
+		y2--;
+	}
+
+	// Nothing visible at all, LVGL still needs an area, so keep a single pixel
+	if (y1 > y2) {
+		p_area->x2 = p_area->x1;
+		p_area->y2 = p_area->y1;
+		return;
+	}
+
+	// The columns are the widest visible span of the remaining rows
+	int32_t x1 = INT32_MAX;
+	int32_t x2 = INT32_MIN;
+	for (int32_t y = y1; y <= y2; y++) {
+		if (getVisibleSpan(y, p_area->x1, p_area->x2, &start, &end)) {
+			x1 = start < x1 ? start : x1;
+			x2 = end > x2 ? end : x2;
+		}
+	}
+
+	p_area->x1 = x1;
+	p_area->x2 = x2;
+	p_area->y1 = y1;
+	p_area->y2 = y2;
+}
+
+uint8_t roundMaskSplit(const lv_area_t* p_area, uint8_t* p_pixels, const uint8_t bytesPerPixel,
+					   RoundMaskWindow_t* p_windows)
+{
+	const int32_t areaWidth = lv_area_get_width(p_area);
+
+	// Without a mask the area is sent as it is
+	if (g_diameter == 0 || lv_area_get_height(p_area) > ROUND_MASK_MAX_DIAMETER) {
+		p_windows[0].area = *p_area;
+		p_windows[0].offsetB = 0;
+		p_windows[0].sizeB = lv_area_get_size(p_area) * bytesPerPixel;
+		return 1;
+	}
+
+	// Fewer windows are cheaper to set up, raise their price until they fit
+	const int32_t rows = lv_area_get_height(p_area);
+	uint32_t overheadB = WINDOW_OVERHEAD_B;
+	uint8_t amount = findWindows(p_area, bytesPerPixel, overheadB);
+	while (amount > ROUND_MASK_MAX_WINDOWS) {
+		overheadB *= 2;
+		amount = findWindows(p_area, bytesPerPixel, overheadB);
+	}
+
+	// Walk back through the cheapest split, the windows come out last to first
+	uint8_t index = amount;
+	int32_t end = rows;
+	while (end > 0) {
+		const int32_t start = g_windowStart[end];
+		if (start == end - 1 && !isRowVisible(p_area, p_area->y1 + start)) {
+			end = start;
+			continue;
+		}
+
+		RoundMaskWindow_t* p_window = &p_windows[--index];
+		p_window->area.y1 = p_area->y1 + start;
+		p_window->area.y2 = p_area->y1 + end - 1;
+		p_window->area.x1 = INT32_MAX;
+		p_window->area.x2 = INT32_MIN;
+		for (int32_t y = p_window->area.y1; y <= p_window->area.y2; y++) {
+			int32_t spanStart = 0;
+			int32_t spanEnd = 0;
+			getVisibleSpan(y, p_area->x1, p_area->x2, &spanStart, &spanEnd);
+			p_window->area.x1 = spanStart < p_window->area.x1 ? spanStart : p_window->area.x1;
+			p_window->area.x2 = spanEnd > p_window->area.x2 ? spanEnd : p_window->area.x2;
+		}
+		end = start;
+	}
+
+	/*
+	 *	Pack the pixels of every window
+	 */
+	for (uint8_t i = 0; i < amount; i++) {
+		RoundMaskWindow_t* p_current = &p_windows[i];
+		const int32_t width = lv_area_get_width(&p_current->area);
+		const uint32_t rowSizeB = width * bytesPerPixel;
+
+		// The packed window starts where its first row started, every row only moves towards the front
+		p_current->offsetB = (p_current->area.y1 - p_area->y1) * areaWidth * bytesPerPixel;
+		p_current->sizeB = lv_area_get_size(&p_current->area) * bytesPerPixel;
+		if (width == areaWidth) {
+			continue;
+		}
+
+		uint8_t* p_destination = p_pixels + p_current->offsetB;
+		for (int32_t y = p_current->area.y1; y <= p_current->area.y2; y++) {
+			const uint8_t* p_source =
+				p_pixels + ((y - p_area->y1) * areaWidth + (p_current->area.x1 - p_area->x1)) * bytesPerPixel;
+			memmove(p_destination, p_source, rowSizeB);
+			p_destination += rowSizeB;
+		}
+	}
+
+	return amount;
+}
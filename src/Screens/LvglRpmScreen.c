@@ -1,5 +1,12 @@
 #include "Screens/LvglRpmScreen.h"
 
+// Project includes
+#include "AssetResidency.h"
+#include "Fonts.h"
+#include "GuiBindings.h"
+#include "Images.h"
+#include "Widgets/LvglDigitDisplay.h"
+
 // C includes
 #include <string.h>
 
@@ -12,30 +19,79 @@
 typedef struct
 {
 	lv_obj_t* screen;
-	lv_obj_t* rpmLabel;
-	lv_style_t rpmLabelStyle;
+	LvglDigitDisplay_t rpmDigits;
 	lv_obj_t* rpmTitleLabel;
 	lv_style_t rpmTitleStyle;
 	lv_obj_t* leftIndicator;
-	char rpm[7];
 } RpmScreen_t;
 
+/*
+ *	Prototypes
+ */
+//! \brief Shows the rpm, the LVGL semaphore has to be held
+//! \param value The rpm
+static void applyRpm(int32_t value);
+
+//! \brief Shows the state of the left indicator, the LVGL semaphore has to be held
+//! \param value Zero if the indicator is off
+static void applyLeftIndicator(int32_t value);
+
 /*
  *	Private variables
  */
 static RpmScreen_t* g_instance = NULL;
 
+//! \brief The signals shown by this screen. The rpm jitters on the bus, so small changes are not shown. It is
+//! interpolated every frame, so the digits count through instead of jumping between samples
+static const GuiBinding_t g_bindings[] = {
+	// Signal, setter, min interval in ms, threshold, hysteresis, lag budget in ms
+	{SENSOR_SIGNAL_RPM, applyRpm, 0, 10, 20, 100},
+	{SENSOR_SIGNAL_LEFT_INDICATOR, applyLeftIndicator, 0, 1, 0, 0},
+};
+
+/*
+ *	Private function implementations
+ */
+static void applyRpm(const int32_t value)
+{
+	if (g_instance == NULL) {
+		return;
+	}
+
+	// Only redraws the digits which changed, 3210 -> 3220 touches a single cell
+	lvglDigitDisplaySetValue(&g_instance->rpmDigits, value < 0 ? 0 : (uint32_t)value);
+}
+
+static void applyLeftIndicator(const int32_t value)
+{
+	if (g_instance == NULL) {
+		return;
+	}
+
+	if (value != 0) {
+		// Activate the indicator visually
+		lv_obj_set_style_opa(g_instance->leftIndicator, LV_OPA_100, LV_PART_MAIN);
+	} else {
+		// Deactivate the indicator visually
+		lv_obj_set_style_opa(g_instance->leftIndicator, LV_OPA_20, LV_PART_MAIN);
+	}
+}
+
 /*
  *	Public function implementations
  */
-bool guiCreateAndShowRpmScreen(const SemaphoreHandle_t* p_guiSemaphore)
+bool guiCreateRpmScreen(const SemaphoreHandle_t* p_guiSemaphore)
 {
+	// The screen is kept resident once it was built
 	if (g_instance != NULL) {
-		return false;
+		return true;
 	}
 
 	// Create the struct
-	g_instance = malloc(sizeof(RpmScreen_t));
+	g_instance = calloc(1, sizeof(RpmScreen_t));
+	if (g_instance == NULL) {
+		return false;
+	}
 
 	// Create the GUI
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
@@ -45,25 +101,24 @@ bool guiCreateAndShowRpmScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		// Set the background for the display
 		lv_obj_set_style_bg_color(g_instance->screen, lv_color_hex(0x000000), LV_PART_MAIN);
 
-		// Include fonts
-		LV_FONT_DECLARE(E1234_70_FONT);
-		LV_FONT_DECLARE(VCR_OSD_MONO_24_FONT);
-		LV_IMAGE_DECLARE(leftIndicator);
-
 		/*
 		 *	Rpm label
 		 */
 
-		// Create the rpm label
-		g_instance->rpmLabel = lv_label_create(g_instance->screen);
-		lv_style_init(&g_instance->rpmLabelStyle);
-		lv_style_set_text_color(&g_instance->rpmLabelStyle, lv_color_hex(0x008F3C));
-		lv_style_set_text_font(&g_instance->rpmLabelStyle, &E1234_70_FONT);
-		lv_obj_add_style(g_instance->rpmLabel, &g_instance->rpmLabelStyle, LV_PART_MAIN);
+		// Create the rpm digits, only changed digits are redrawn
+		const LvglDigitGlyphs_t* p_rpmGlyphs = lvglDigitGlyphsGet(&E1234_70_FONT);
+		if (!lvglDigitDisplayCreate(&g_instance->rpmDigits, g_instance->screen, p_rpmGlyphs, 5,
+									lv_color_hex(0x008F3C))) {
+			lv_obj_delete(g_instance->screen);
+			xSemaphoreGive(*p_guiSemaphore);
+			free(g_instance);
+			g_instance = NULL;
+			return false;
+		}
 
-		// Style the rpm label
-		lv_obj_center(g_instance->rpmLabel);
-		lv_label_set_text(g_instance->rpmLabel, "7700");
+		// Center the rpm digits
+		lvglDigitDisplayAlign(&g_instance->rpmDigits, LV_ALIGN_CENTER, 0, 0);
+		lvglDigitDisplaySetValue(&g_instance->rpmDigits, 7700);
 
 		/*
 		 *	Rpm title label
@@ -73,7 +128,7 @@ bool guiCreateAndShowRpmScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		g_instance->rpmTitleLabel = lv_label_create(g_instance->screen);
 		lv_style_init(&g_instance->rpmTitleStyle);
 		lv_style_set_text_color(&g_instance->rpmTitleStyle, lv_color_hex(0x008F3C));
-		lv_style_set_text_font(&g_instance->rpmTitleStyle, &VCR_OSD_MONO_24_FONT);
+		assetResidencyBindFont(&g_instance->rpmTitleStyle, &VCR_OSD_MONO_24_FONT);
 		lv_obj_add_style(g_instance->rpmTitleLabel, &g_instance->rpmTitleStyle, LV_PART_MAIN);
 
 		// Style the rpm title label
@@ -86,7 +141,12 @@ bool guiCreateAndShowRpmScreen(const SemaphoreHandle_t* p_guiSemaphore)
 
 		// Create the left indicator arrow
 		g_instance->leftIndicator = lv_image_create(g_instance->screen);
-		lv_image_set_src(g_instance->leftIndicator, &leftIndicator);
+		assetResidencyBindImage(g_instance->leftIndicator, &leftIndicator);
+
+		// The image only stores the shape, the color is applied while drawing
+		lv_obj_set_style_image_recolor(g_instance->leftIndicator, lv_color_hex(IMAGE_LEFT_INDICATOR_COLOR),
+									   LV_PART_MAIN);
+		lv_obj_set_style_image_recolor_opa(g_instance->leftIndicator, LV_OPA_COVER, LV_PART_MAIN);
 
 		// Style the left indicator
 		lv_obj_align(g_instance->leftIndicator, LV_ALIGN_CENTER, 0, 90);
@@ -94,41 +154,63 @@ bool guiCreateAndShowRpmScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		// Disable the indicator visually
 		lv_obj_set_style_opa(g_instance->leftIndicator, LV_OPA_20, LV_PART_MAIN);
 
-		/*
-		 *	Load the screen
-		 */
-		lv_screen_load(g_instance->screen);
-
 		// Free the semaphore
 		xSemaphoreGive(*p_guiSemaphore);
 		return true;
 	}
 
+	// Couldn't build the screen
+	free(g_instance);
+	g_instance = NULL;
+
 	return false;
 }
 
-void guiDestroyRpmScreen()
+bool guiShowRpmScreen(const SemaphoreHandle_t* p_guiSemaphore)
 {
-	if (g_instance != NULL) {
-		free(g_instance);
+	if (g_instance == NULL) {
+		return false;
 	}
+
+	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
+		// Only swaps the active screen, all objects already exist
+		lv_screen_load(g_instance->screen);
+
+		xSemaphoreGive(*p_guiSemaphore);
+		return true;
+	}
+
+	return false;
 }
 
-void guiSetRpm(const uint16_t rpm, const SemaphoreHandle_t* p_guiSemaphore)
+void guiDestroyRpmScreen(const SemaphoreHandle_t* p_guiSemaphore)
 {
 	if (g_instance == NULL) {
 		return;
 	}
 
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
-		// Clear the old text
-		memset(&g_instance->rpm, ' ', sizeof(g_instance->rpm));
+		// Deleting the screen also deletes all of its children
+		lv_obj_delete(g_instance->screen);
+		assetResidencyUnbindFont(&g_instance->rpmTitleStyle);
+		lv_style_reset(&g_instance->rpmTitleStyle);
 
-		// Set the text
-		snprintf(g_instance->rpm, sizeof(g_instance->rpm), "%d", rpm);
+		xSemaphoreGive(*p_guiSemaphore);
+	}
+
+	free(g_instance);
+	g_instance = NULL;
+}
+
+
+void guiSetRpm(const uint16_t rpm, const SemaphoreHandle_t* p_guiSemaphore)
+{
+	if (g_instance == NULL) {
+		return;
+	}
 
-		// Apply it to the label
-		lv_label_set_text(g_instance->rpmLabel, g_instance->rpm);
+	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
+		applyRpm(rpm);
 
 		xSemaphoreGive(*p_guiSemaphore);
 	}
@@ -141,14 +223,14 @@ void guiSetLeftIndicatorActive(const bool active, const SemaphoreHandle_t* p_gui
 	}
 
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
-		if (active) {
-			// Activate the indicator visually
-			lv_obj_set_style_opa(g_instance->leftIndicator, LV_OPA_100, LV_PART_MAIN);
-		} else {
-			// Deactivate the indicator visually
-			lv_obj_set_style_opa(g_instance->leftIndicator, LV_OPA_20, LV_PART_MAIN);
-		}
+		applyLeftIndicator(active);
 
 		xSemaphoreGive(*p_guiSemaphore);
 	}
 }
+
+const GuiBinding_t* guiGetRpmScreenBindings(uint8_t* p_amount)
+{
+	*p_amount = sizeof(g_bindings) / sizeof(GuiBinding_t);
+	return g_bindings;
+}
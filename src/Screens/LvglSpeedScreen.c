@@ -1,5 +1,13 @@
 #include "Screens/LvglSpeedScreen.h"
 
+// Project includes
+#include "AssetResidency.h"
+#include "Fonts.h"
+#include "GuiBindings.h"
+#include "Images.h"
+#include "LvglImage.h"
+#include "Widgets/LvglDigitDisplay.h"
+
 // C includes
 #include <string.h>
 
@@ -12,30 +20,79 @@
 typedef struct
 {
 	lv_obj_t* screen;
-	lv_obj_t* speedLabel;
-	lv_style_t speedLabelStyle;
+	LvglDigitDisplay_t speedDigits;
 	lv_obj_t* kmhLabel;
 	lv_style_t kmhLabelStyle;
 	lv_obj_t* rightIndicator;
-	char speed[4];
+	lv_draw_buf_t* p_rightIndicatorImage;
 } SpeedScreen_t;
 
+/*
+ *	Prototypes
+ */
+//! \brief Shows the speed, the LVGL semaphore has to be held
+//! \param value The speed in km/h
+static void applySpeed(int32_t value);
+
+//! \brief Shows the state of the right indicator, the LVGL semaphore has to be held
+//! \param value Zero if the indicator is off
+static void applyRightIndicator(int32_t value);
+
 /*
  *	Private variables
  */
 static SpeedScreen_t* g_instance = NULL;
 
+//! \brief The signals shown by this screen. The speed counts through the values between two samples
+static const GuiBinding_t g_bindings[] = {
+	// Signal, setter, min interval in ms, threshold, hysteresis, lag budget in ms
+	{SENSOR_SIGNAL_SPEED, applySpeed, 0, 1, 1, 150},
+	{SENSOR_SIGNAL_RIGHT_INDICATOR, applyRightIndicator, 0, 1, 0, 0},
+};
+
+/*
+ *	Private function implementations
+ */
+static void applySpeed(const int32_t value)
+{
+	if (g_instance == NULL) {
+		return;
+	}
+
+	// Only redraws the digits which changed
+	lvglDigitDisplaySetValue(&g_instance->speedDigits, value < 0 ? 0 : (uint32_t)value);
+}
+
+static void applyRightIndicator(const int32_t value)
+{
+	if (g_instance == NULL) {
+		return;
+	}
+
+	if (value != 0) {
+		// Activate the indicator visually
+		lv_obj_set_style_opa(g_instance->rightIndicator, LV_OPA_100, LV_PART_MAIN);
+	} else {
+		// Deactivate the indicator visually
+		lv_obj_set_style_opa(g_instance->rightIndicator, LV_OPA_20, LV_PART_MAIN);
+	}
+}
+
 /*
  *	Public function implementations
  */
-bool guiCreateAndShowSpeedScreen(const SemaphoreHandle_t* p_guiSemaphore)
+bool guiCreateSpeedScreen(const SemaphoreHandle_t* p_guiSemaphore)
 {
+	// The screen is kept resident once it was built
 	if (g_instance != NULL) {
-		return false;
+		return true;
 	}
 
 	// Create the struct
-	g_instance = malloc(sizeof(SpeedScreen_t));
+	g_instance = calloc(1, sizeof(SpeedScreen_t));
+	if (g_instance == NULL) {
+		return false;
+	}
 
 	// Create the GUI
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
@@ -45,25 +102,24 @@ bool guiCreateAndShowSpeedScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		// Set the background for the display
 		lv_obj_set_style_bg_color(g_instance->screen, lv_color_hex(0x000000), LV_PART_MAIN);
 
-		// Include fonts
-		LV_FONT_DECLARE(E1234_80_FONT);
-		LV_FONT_DECLARE(VCR_OSD_MONO_24_FONT);
-		LV_IMAGE_DECLARE(rightIndicator);
-
 		/*
 		 *	Speedometer label
 		 */
 
-		// Create the speedometer label
-		g_instance->speedLabel = lv_label_create(g_instance->screen);
-		lv_style_init(&g_instance->speedLabelStyle);
-		lv_style_set_text_color(&g_instance->speedLabelStyle, lv_color_hex(0x008F3C));
-		lv_style_set_text_font(&g_instance->speedLabelStyle, &E1234_80_FONT);
-		lv_obj_add_style(g_instance->speedLabel, &g_instance->speedLabelStyle, LV_PART_MAIN);
+		// Create the speedometer digits, only changed digits are redrawn
+		const LvglDigitGlyphs_t* p_speedGlyphs = lvglDigitGlyphsGet(&E1234_80_FONT);
+		if (!lvglDigitDisplayCreate(&g_instance->speedDigits, g_instance->screen, p_speedGlyphs, 3,
+									lv_color_hex(0x008F3C))) {
+			lv_obj_delete(g_instance->screen);
+			xSemaphoreGive(*p_guiSemaphore);
+			free(g_instance);
+			g_instance = NULL;
+			return false;
+		}
 
-		// Style the speedometer label
-		lv_obj_center(g_instance->speedLabel);
-		lv_label_set_text(g_instance->speedLabel, "200");
+		// Center the speedometer digits
+		lvglDigitDisplayAlign(&g_instance->speedDigits, LV_ALIGN_CENTER, 0, 0);
+		lvglDigitDisplaySetValue(&g_instance->speedDigits, 200);
 
 		/*
 		 *	Kmh label
@@ -73,7 +129,7 @@ bool guiCreateAndShowSpeedScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		g_instance->kmhLabel = lv_label_create(g_instance->screen);
 		lv_style_init(&g_instance->kmhLabelStyle);
 		lv_style_set_text_color(&g_instance->kmhLabelStyle, lv_color_hex(0x008F3C));
-		lv_style_set_text_font(&g_instance->kmhLabelStyle, &VCR_OSD_MONO_24_FONT);
+		assetResidencyBindFont(&g_instance->kmhLabelStyle, &VCR_OSD_MONO_24_FONT);
 		lv_obj_add_style(g_instance->kmhLabel, &g_instance->kmhLabelStyle, LV_PART_MAIN);
 
 		// Style the kmh label
@@ -84,9 +140,26 @@ bool guiCreateAndShowSpeedScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		 *	Right indicator
 		 */
 
+		// The right arrow is the mirrored left one, so only one of them is stored in flash
+		g_instance->p_rightIndicatorImage = lvglImageCreateMirrored(&leftIndicator);
+		if (g_instance->p_rightIndicatorImage == NULL) {
+			lv_obj_delete(g_instance->screen);
+			assetResidencyUnbindFont(&g_instance->kmhLabelStyle);
+			lv_style_reset(&g_instance->kmhLabelStyle);
+			xSemaphoreGive(*p_guiSemaphore);
+			free(g_instance);
+			g_instance = NULL;
+			return false;
+		}
+
 		// Create the indicator right arrow
 		g_instance->rightIndicator = lv_image_create(g_instance->screen);
-		lv_image_set_src(g_instance->rightIndicator, &rightIndicator);
+		lv_image_set_src(g_instance->rightIndicator, g_instance->p_rightIndicatorImage);
+
+		// The image only stores the shape, the color is applied while drawing
+		lv_obj_set_style_image_recolor(g_instance->rightIndicator, lv_color_hex(IMAGE_LEFT_INDICATOR_COLOR),
+									   LV_PART_MAIN);
+		lv_obj_set_style_image_recolor_opa(g_instance->rightIndicator, LV_OPA_COVER, LV_PART_MAIN);
 
 		// Position it centered at the bottom
 		lv_obj_align(g_instance->rightIndicator, LV_ALIGN_CENTER, 0, 90);
@@ -94,40 +167,65 @@ bool guiCreateAndShowSpeedScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		// Disable the indicator visually
 		lv_obj_set_style_opa(g_instance->rightIndicator, LV_OPA_20, LV_PART_MAIN);
 
-		/*
-		 *	Load the screen
-		 */
-		lv_screen_load(g_instance->screen);
-
 		// Free the semaphore
 		xSemaphoreGive(*p_guiSemaphore);
 		return true;
 	}
 
+	// Couldn't build the screen
+	free(g_instance);
+	g_instance = NULL;
+
 	return false;
 }
 
-void guiDestroySpeedScreen()
+bool guiShowSpeedScreen(const SemaphoreHandle_t* p_guiSemaphore)
 {
-	if (g_instance != NULL) {
-		free(g_instance);
+	if (g_instance == NULL) {
+		return false;
 	}
+
+	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
+		// Only swaps the active screen, all objects already exist
+		lv_screen_load(g_instance->screen);
+
+		xSemaphoreGive(*p_guiSemaphore);
+		return true;
+	}
+
+	return false;
 }
-void guiSetSpeed(const uint8_t speedKmh, const SemaphoreHandle_t* p_guiSemaphore)
+
+void guiDestroySpeedScreen(const SemaphoreHandle_t* p_guiSemaphore)
 {
 	if (g_instance == NULL) {
 		return;
 	}
 
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
-		// Clear the old text
-		memset(&g_instance->speed, ' ', sizeof(g_instance->speed));
+		// Deleting the screen also deletes all of its children
+		lv_obj_delete(g_instance->screen);
+		assetResidencyUnbindFont(&g_instance->kmhLabelStyle);
+		lv_style_reset(&g_instance->kmhLabelStyle);
 
-		// Set the text
-		snprintf(g_instance->speed, sizeof(g_instance->speed), "%d", speedKmh);
+		// The image isn't used anymore once its object was deleted
+		lvglImageDestroyMirrored(g_instance->p_rightIndicatorImage);
 
-		// Apply it to the label
-		lv_label_set_text(g_instance->speedLabel, g_instance->speed);
+		xSemaphoreGive(*p_guiSemaphore);
+	}
+
+	free(g_instance);
+	g_instance = NULL;
+}
+
+void guiSetSpeed(const uint8_t speedKmh, const SemaphoreHandle_t* p_guiSemaphore)
+{
+	if (g_instance == NULL) {
+		return;
+	}
+
+	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
+		applySpeed(speedKmh);
 
 		xSemaphoreGive(*p_guiSemaphore);
 	}
@@ -140,14 +238,14 @@ void guiSetRightIndicatorActive(const bool active, const SemaphoreHandle_t* p_gu
 	}
 
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
-		if (active) {
-			// Activate the indicator visually
-			lv_obj_set_style_opa(g_instance->rightIndicator, LV_OPA_100, LV_PART_MAIN);
-		} else {
-			// Deactivate the indicator visually
-			lv_obj_set_style_opa(g_instance->rightIndicator, LV_OPA_20, LV_PART_MAIN);
-		}
+		applyRightIndicator(active);
 
 		xSemaphoreGive(*p_guiSemaphore);
 	}
+}
+
+const GuiBinding_t* guiGetSpeedScreenBindings(uint8_t* p_amount)
+{
+	*p_amount = sizeof(g_bindings) / sizeof(GuiBinding_t);
+	return g_bindings;
 }
\ No newline at end of file
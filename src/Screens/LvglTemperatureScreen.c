@@ -1,11 +1,22 @@
 #include "Screens/LvglTemperatureScreen.h"
 
+// Project includes
+#include "AssetResidency.h"
+#include "Fonts.h"
+#include "GuiBindings.h"
+#include "Widgets/LvglDigitDisplay.h"
+#include "Widgets/LvglSegmentRing.h"
+
 // C includes
 #include <string.h>
 
 // LVGL include
 #include "lvgl.h"
 
+/*
+ *	Private defines
+ */
+#define FUEL_LEVEL_SEGMENTS 10
 
 /*
  *	Private typedefs
@@ -13,37 +24,103 @@
 typedef struct
 {
 	lv_obj_t* screen;
-	lv_obj_t* tempLabel;
-	lv_style_t tempLabelStyle;
+	LvglDigitDisplay_t tempDigits;
 	lv_obj_t* celsiusLabel;
 	lv_style_t celsiusStyle;
-	lv_obj_t* fuelLevelArcs[10];
-	lv_style_t fuelLevelArcStyle;
+	LvglSegmentRing_t fuelLevelRing;
 	lv_obj_t* fuelLevelInPercentLabel;
 	lv_obj_t* fuelLevelInLitreLabel;
 	lv_style_t fuelLevelLabelStyle;
 	int lastFuelInPercent;
-	char waterTemp[4];
 	char fuelLevelP[5];
 	char fuelLevelL[5];
 } TempScreen_t;
 
+/*
+ *	Prototypes
+ */
+//! \brief Shows the water temperature, the LVGL semaphore has to be held
+//! \param value The temperature in °C
+static void applyWaterTemp(int32_t value);
+
+//! \brief Shows the fuel level, the LVGL semaphore has to be held
+//! \param value The fuel level in percent
+static void applyFuelLevel(int32_t value);
+
 /*
  *	Private variables
  */
 static TempScreen_t* g_instance = NULL;
 
+//! \brief The signals shown by this screen. Both change slowly, but the sensors flicker between neighbouring values
+static const GuiBinding_t g_bindings[] = {
+	// Signal, setter, min interval in ms, threshold, hysteresis, lag budget in ms
+	{SENSOR_SIGNAL_WATER_TEMP, applyWaterTemp, 500, 1, 1, 0},
+	{SENSOR_SIGNAL_FUEL_LEVEL, applyFuelLevel, 1000, 1, 1, 0},
+};
+
+/*
+ *	Private function implementations
+ */
+static void applyWaterTemp(const int32_t value)
+{
+	if (g_instance == NULL) {
+		return;
+	}
+
+	// Only redraws the digits which changed
+	lvglDigitDisplaySetValue(&g_instance->tempDigits, value < 0 ? 0 : (uint32_t)value);
+}
+
+static void applyFuelLevel(const int32_t value)
+{
+	if (g_instance == NULL) {
+		return;
+	}
+
+	const uint8_t levelInPercent = (uint8_t)value;
+
+	// Every started tenth lights a segment, only the segments that changed are redrawn
+	lvglSegmentRingSetLit(&g_instance->fuelLevelRing, (levelInPercent * FUEL_LEVEL_SEGMENTS + 99) / 100);
+
+	// Clear the old text
+	memset(&g_instance->fuelLevelP, ' ', sizeof(g_instance->fuelLevelP));
+	memset(&g_instance->fuelLevelL, ' ', sizeof(g_instance->fuelLevelL));
+
+	// Set the text
+	snprintf(g_instance->fuelLevelP, sizeof(g_instance->fuelLevelP), "%d%%", levelInPercent);
+
+	// Convert the percent to a double
+	const double percent = ((double)levelInPercent) / 100.0;
+
+	// Special case if levelInPercent is 0
+	if (percent == 0) {
+		snprintf(g_instance->fuelLevelL, sizeof(g_instance->fuelLevelL), "%dL", 0);
+	} else {
+		snprintf(g_instance->fuelLevelL, sizeof(g_instance->fuelLevelL), "%dL",
+				 (uint8_t)(50.0 / percent));
+	}
+
+	// Apply the text to the labels
+	lv_label_set_text(g_instance->fuelLevelInLitreLabel, g_instance->fuelLevelL);
+	lv_label_set_text(g_instance->fuelLevelInPercentLabel, g_instance->fuelLevelP);
+}
+
 /*
  *	Public function implementations
  */
-bool guiCreateAndShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore) // NOLINT
+bool guiCreateTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore) // NOLINT
 {
+	// The screen is kept resident once it was built
 	if (g_instance != NULL) {
-		return false;
+		return true;
 	}
 
 	// Create the struct
-	g_instance = malloc(sizeof(TempScreen_t));
+	g_instance = calloc(1, sizeof(TempScreen_t));
+	if (g_instance == NULL) {
+		return false;
+	}
 
 	// Create the GUI
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
@@ -53,24 +130,24 @@ bool guiCreateAndShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		// Set the background for the display
 		lv_obj_set_style_bg_color(g_instance->screen, lv_color_hex(0x000000), LV_PART_MAIN);
 
-		// Include fonts
-		LV_FONT_DECLARE(E1234_80_FONT);
-		LV_FONT_DECLARE(VCR_OSD_MONO_24_FONT);
-
 		/*
 		 *	Temp label
 		 */
 
-		// Create the temp label
-		g_instance->tempLabel = lv_label_create(g_instance->screen);
-		lv_style_init(&g_instance->tempLabelStyle);
-		lv_style_set_text_color(&g_instance->tempLabelStyle, lv_color_hex(0x008F3C));
-		lv_style_set_text_font(&g_instance->tempLabelStyle, &E1234_80_FONT);
-		lv_obj_add_style(g_instance->tempLabel, &g_instance->tempLabelStyle, LV_PART_MAIN);
+		// Create the temp digits, only changed digits are redrawn
+		const LvglDigitGlyphs_t* p_tempGlyphs = lvglDigitGlyphsGet(&E1234_80_FONT);
+		if (!lvglDigitDisplayCreate(&g_instance->tempDigits, g_instance->screen, p_tempGlyphs, 3,
+									lv_color_hex(0x008F3C))) {
+			lv_obj_delete(g_instance->screen);
+			xSemaphoreGive(*p_guiSemaphore);
+			free(g_instance);
+			g_instance = NULL;
+			return false;
+		}
 
-		// Style the temp label
-		lv_obj_align(g_instance->tempLabel, LV_ALIGN_CENTER, 10, 0);
-		lv_label_set_text(g_instance->tempLabel, "90");
+		// Style the temp digits
+		lvglDigitDisplayAlign(&g_instance->tempDigits, LV_ALIGN_CENTER, 10, 0);
+		lvglDigitDisplaySetValue(&g_instance->tempDigits, 90);
 
 		/*
 		 *	Temp title label
@@ -80,7 +157,7 @@ bool guiCreateAndShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		g_instance->celsiusLabel = lv_label_create(g_instance->screen);
 		lv_style_init(&g_instance->celsiusStyle);
 		lv_style_set_text_color(&g_instance->celsiusStyle, lv_color_hex(0x008F3C));
-		lv_style_set_text_font(&g_instance->celsiusStyle, &VCR_OSD_MONO_24_FONT);
+		assetResidencyBindFont(&g_instance->celsiusStyle, &VCR_OSD_MONO_24_FONT);
 		lv_obj_add_style(g_instance->celsiusLabel, &g_instance->celsiusStyle, LV_PART_MAIN);
 
 		// Style the temp title label
@@ -88,44 +165,47 @@ bool guiCreateAndShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		lv_label_set_text(g_instance->celsiusLabel, "°C");
 
 		/*
-		 *	Fuel level arc
+		 *	Fuel level ring
 		 */
 
-		// Create the arc background style
-		lv_style_init(&g_instance->fuelLevelArcStyle);
-		lv_style_set_arc_color(&g_instance->fuelLevelArcStyle, lv_color_hex(0x008F3C));
-		lv_style_set_arc_rounded(&g_instance->fuelLevelArcStyle, false);
-
-		// Create the 10 arcs for the fuel level
-		for (int i = 0; i < 10; i++) {
-			// Create the arc
-			g_instance->fuelLevelArcs[i] = lv_arc_create(g_instance->screen);
-			lv_obj_set_width(g_instance->fuelLevelArcs[i], 220);
-			lv_obj_set_height(g_instance->fuelLevelArcs[i], 220);
-			lv_obj_set_style_arc_width(g_instance->fuelLevelArcs[i], 20, LV_PART_MAIN);
-
-			// Position it
-			lv_obj_center(g_instance->fuelLevelArcs[i]);
-			lv_arc_set_bg_angles(g_instance->fuelLevelArcs[i], 0, 12);
-			lv_arc_set_rotation(g_instance->fuelLevelArcs[i], 100 + i * 16); // Initial rotation + offset per arc
-			lv_arc_set_value(g_instance->fuelLevelArcs[i], 100);
-
-			// Remove the knob & indicator
-			lv_obj_set_style_opa(g_instance->fuelLevelArcs[i], LV_OPA_0, LV_PART_KNOB);
-			lv_obj_set_style_opa(g_instance->fuelLevelArcs[i], LV_OPA_0, LV_PART_INDICATOR);
-
-			// Apply the background style
-			lv_obj_add_style(g_instance->fuelLevelArcs[i], &g_instance->fuelLevelArcStyle, LV_PART_MAIN);
-
-			// Color it accordingly
+		// Color the segments accordingly
+		lv_color_t fuelLevelColors[FUEL_LEVEL_SEGMENTS];
+		for (uint8_t i = 0; i < FUEL_LEVEL_SEGMENTS; i++) {
 			if (i == 0) {
-				lv_obj_set_style_arc_color(g_instance->fuelLevelArcs[i], lv_color_hex(0x992600), LV_PART_MAIN);
+				fuelLevelColors[i] = lv_color_hex(0x992600);
 			}
 			else if (i <= 2) {
-				lv_obj_set_style_arc_color(g_instance->fuelLevelArcs[i], lv_color_hex(0xC69800), LV_PART_MAIN);
+				fuelLevelColors[i] = lv_color_hex(0xC69800);
+			}
+			else {
+				fuelLevelColors[i] = lv_color_hex(0x008F3C);
 			}
 		}
 
+		// The segments start at the bottom and grow clockwise, one segment per tenth of the tank
+		const LvglSegmentRingConfig_t fuelLevelRingConfig = {
+			.diameter = 220,
+			.width = 20,
+			.startAngle = 100,
+			.segmentAngle = 12,
+			.gapAngle = 4,
+			.segmentCount = FUEL_LEVEL_SEGMENTS,
+			.p_colors = fuelLevelColors,
+			.offColor = lv_color_hex(0x202020),
+		};
+
+		// Create the ring, all segments are drawn by one object from pre-rendered masks
+		if (!lvglSegmentRingCreate(&g_instance->fuelLevelRing, g_instance->screen, &fuelLevelRingConfig)) {
+			lv_obj_delete(g_instance->screen);
+			assetResidencyUnbindFont(&g_instance->celsiusStyle);
+			lv_style_reset(&g_instance->celsiusStyle);
+			xSemaphoreGive(*p_guiSemaphore);
+			free(g_instance);
+			g_instance = NULL;
+			return false;
+		}
+		lv_obj_center(g_instance->fuelLevelRing.obj);
+
 		/*
 		 *	Fuel level in percent label
 		 */
@@ -134,7 +214,7 @@ bool guiCreateAndShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		g_instance->fuelLevelInPercentLabel = lv_label_create(g_instance->screen);
 		lv_style_init(&g_instance->fuelLevelLabelStyle);
 		lv_style_set_text_color(&g_instance->fuelLevelLabelStyle, lv_color_hex(0x008F3C));
-		lv_style_set_text_font(&g_instance->fuelLevelLabelStyle, &VCR_OSD_MONO_24_FONT);
+		assetResidencyBindFont(&g_instance->fuelLevelLabelStyle, &VCR_OSD_MONO_24_FONT);
 		lv_obj_add_style(g_instance->fuelLevelInPercentLabel, &g_instance->fuelLevelLabelStyle, LV_PART_MAIN);
 
 		// Style the fuel level in percent label
@@ -153,40 +233,65 @@ bool guiCreateAndShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore)
 		lv_obj_align(g_instance->fuelLevelInLitreLabel, LV_ALIGN_BOTTOM_MID, 15, -30);
 		lv_label_set_text(g_instance->fuelLevelInLitreLabel, "50L");
 
-		/*
-		 *	Load the screen
-		 */
-		lv_screen_load(g_instance->screen);
-
 		// Free the semaphore
 		xSemaphoreGive(*p_guiSemaphore);
 
 		return true;
 	}
+
+	// Couldn't build the screen
+	free(g_instance);
+	g_instance = NULL;
+
 	return false;
 }
 
-void guiDestroyTemperatureScreen()
+bool guiShowTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore)
 {
-	if (g_instance != NULL) {
-		free(g_instance);
+	if (g_instance == NULL) {
+		return false;
 	}
+
+	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
+		// Only swaps the active screen, all objects already exist
+		lv_screen_load(g_instance->screen);
+
+		xSemaphoreGive(*p_guiSemaphore);
+		return true;
+	}
+
+	return false;
 }
-void guiSetWaterTemp(const uint8_t temp, const SemaphoreHandle_t* p_guiSemaphore)
+
+void guiDestroyTemperatureScreen(const SemaphoreHandle_t* p_guiSemaphore)
 {
 	if (g_instance == NULL) {
 		return;
 	}
 
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
-		// Clear the old text
-		memset(&g_instance->waterTemp, ' ', sizeof(g_instance->waterTemp));
+		// Deleting the screen also deletes all of its children
+		lv_obj_delete(g_instance->screen);
+		assetResidencyUnbindFont(&g_instance->celsiusStyle);
+		assetResidencyUnbindFont(&g_instance->fuelLevelLabelStyle);
+		lv_style_reset(&g_instance->celsiusStyle);
+		lv_style_reset(&g_instance->fuelLevelLabelStyle);
 
-		// Set the text
-		snprintf(g_instance->waterTemp, sizeof(g_instance->waterTemp), "%d", temp);
+		xSemaphoreGive(*p_guiSemaphore);
+	}
 
-		// Apply it to the label
-		lv_label_set_text(g_instance->tempLabel, g_instance->waterTemp);
+	free(g_instance);
+	g_instance = NULL;
+}
+
+void guiSetWaterTemp(const uint8_t temp, const SemaphoreHandle_t* p_guiSemaphore)
+{
+	if (g_instance == NULL) {
+		return;
+	}
+
+	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
+		applyWaterTemp(temp);
 
 		xSemaphoreGive(*p_guiSemaphore);
 	}
@@ -199,28 +304,14 @@ void guiSetFuelLevel(const uint8_t levelInPercent, const SemaphoreHandle_t* p_gu
 	}
 
 	if (xSemaphoreTake(*p_guiSemaphore, portMAX_DELAY) == pdTRUE) {
-		// Clear the old text
-		memset(&g_instance->fuelLevelP, ' ', sizeof(g_instance->fuelLevelP));
-		memset(&g_instance->fuelLevelL, ' ', sizeof(g_instance->fuelLevelL));
-
-		// Set the text
-		snprintf(g_instance->fuelLevelP, sizeof(g_instance->fuelLevelP), "%d%%", levelInPercent);
-
-		// Convert the percent to a double
-		const double percent = ((double)levelInPercent) / 100.0;
-
-		// Special case if levelInPercent is 0
-		if (percent == 0) {
-			snprintf(g_instance->fuelLevelL, sizeof(g_instance->fuelLevelL), "%dL", 0);
-		} else {
-			snprintf(g_instance->fuelLevelL, sizeof(g_instance->fuelLevelL), "%dL",
-					 (uint8_t)(50.0 / percent));
-		}
-
-		// Apply the text to the labels
-		lv_label_set_text(g_instance->fuelLevelInLitreLabel, g_instance->fuelLevelL);
-		lv_label_set_text(g_instance->fuelLevelInPercentLabel, g_instance->fuelLevelP);
+		applyFuelLevel(levelInPercent);
 
 		xSemaphoreGive(*p_guiSemaphore);
 	}
 }
+
+const GuiBinding_t* guiGetTemperatureScreenBindings(uint8_t* p_amount)
+{
+	*p_amount = sizeof(g_bindings) / sizeof(GuiBinding_t);
+	return g_bindings;
+}
@@ -0,0 +1,98 @@
+#include "SensorSnapshot.h"
+
+// C includes
+#include <stdatomic.h>
+#include <string.h>
+
+// espidf includes
+#include <esp_timer.h>
+
+/*
+ *	Private variables
+ */
+//! \brief Sequence counter of the seqlock. It is odd while the writer updates the snapshot
+static atomic_uint_fast32_t g_sequence = 0;
+
+//! \brief The sequence of the snapshot which was consumed last
+static atomic_uint_fast32_t g_consumedSequence = 0;
+
+//! \brief Amount of snapshots which were overwritten before being consumed
+static atomic_uint_fast32_t g_droppedCount = 0;
+
+//! \brief The latest snapshot. Only accessed under the seqlock
+static volatile SensorSnapshot_t g_snapshot;
+
+/*
+ *	Public function implementations
+ */
+void sensorSnapshotPublish(const uint8_t* p_buffer, const uint8_t dlc)
+{
+	if (p_buffer == NULL) {
+		return;
+	}
+
+	const uint_fast32_t sequence = atomic_load_explicit(&g_sequence, memory_order_relaxed);
+
+	// The previous snapshot was never shown, it will be overwritten now
+	if (sequence != 0 && atomic_load_explicit(&g_consumedSequence, memory_order_relaxed) != sequence) {
+		atomic_fetch_add_explicit(&g_droppedCount, 1, memory_order_relaxed);
+	}
+
+	// Mark the snapshot as being written
+	atomic_store_explicit(&g_sequence, sequence + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	// Copy the data
+	const uint8_t length = dlc > SENSOR_SNAPSHOT_BUFFER_LENGTH_B ? SENSOR_SNAPSHOT_BUFFER_LENGTH_B : dlc;
+	for (uint8_t i = 0; i < SENSOR_SNAPSHOT_BUFFER_LENGTH_B; i++) {
+		g_snapshot.buffer[i] = i < length ? p_buffer[i] : 0;
+	}
+	g_snapshot.dlc = length;
+	g_snapshot.receivedUs = esp_timer_get_time();
+
+	// Publish it
+	atomic_store_explicit(&g_sequence, sequence + 2, memory_order_release);
+}
+
+bool sensorSnapshotConsume(SensorSnapshot_t* p_snapshot)
+{
+	if (p_snapshot == NULL) {
+		return false;
+	}
+
+	uint_fast32_t sequenceBefore = 0;
+	uint_fast32_t sequenceAfter = 0;
+	do {
+		sequenceBefore = atomic_load_explicit(&g_sequence, memory_order_acquire);
+
+		// Nothing new since the last call
+		if (sequenceBefore == atomic_load_explicit(&g_consumedSequence, memory_order_relaxed)) {
+			return false;
+		}
+
+		// The writer is currently updating the snapshot
+		if (sequenceBefore & 1) {
+			continue;
+		}
+
+		// Copy the data
+		for (uint8_t i = 0; i < SENSOR_SNAPSHOT_BUFFER_LENGTH_B; i++) {
+			p_snapshot->buffer[i] = g_snapshot.buffer[i];
+		}
+		p_snapshot->dlc = g_snapshot.dlc;
+		p_snapshot->receivedUs = g_snapshot.receivedUs;
+
+		// Retry if the writer changed the snapshot while we copied it
+		atomic_thread_fence(memory_order_acquire);
+		sequenceAfter = atomic_load_explicit(&g_sequence, memory_order_relaxed);
+	} while ((sequenceBefore & 1) || sequenceBefore != sequenceAfter);
+
+	atomic_store_explicit(&g_consumedSequence, sequenceBefore, memory_order_relaxed);
+
+	return true;
+}
+
+uint32_t sensorSnapshotGetDroppedCount()
+{
+	return (uint32_t)atomic_load_explicit(&g_droppedCount, memory_order_relaxed);
+}
@@ -0,0 +1,82 @@
+#include "SignalDecoder.h"
+
+// C includes
+#include <stddef.h>
+
+/*
+ *	Prototypes
+ */
+//! \brief Extracts the raw value of a signal
+//! \param p_signal The signal
+//! \param p_words The frame in both byte orders
+//! \retval The sign extended raw value
+static inline int64_t extractRaw(const SignalDescription_t* p_signal, const uint64_t* p_words);
+
+//! \brief Decodes a group of signals
+//! \param p_group The group
+//! \param p_words The frame in both byte orders
+//! \param dlc The dlc of the frame
+//! \param p_values Where the values are written to
+//! \retval Bit mask of the signals which were decoded
+static uint32_t decodeGroup(const SignalGroup_t* p_group, const uint64_t* p_words, uint8_t dlc, int32_t* p_values);
+
+/*
+ *	Private function implementations
+ */
+static inline int64_t extractRaw(const SignalDescription_t* p_signal, const uint64_t* p_words)
+{
+	const uint64_t raw = (p_words[p_signal->byteOrder] >> p_signal->shift) & p_signal->mask;
+
+	// Moves the sign bit to the top and back, unsigned signals have a shift of 0
+	return (int64_t)(raw << p_signal->signShift) >> p_signal->signShift;
+}
+
+static uint32_t decodeGroup(const SignalGroup_t* p_group, const uint64_t* p_words, const uint8_t dlc,
+							int32_t* p_values)
+{
+	uint32_t decoded = 0;
+	for (uint8_t i = 0; i < p_group->amount; i++) {
+		const SignalDescription_t* p_signal = &p_group->p_signals[i];
+		if (p_signal->requiredDlc > dlc) {
+			continue;
+		}
+
+		// Scaled in fixed point, a 64 bit division would be a library call
+		const int64_t raw = extractRaw(p_signal, p_words);
+		p_values[p_signal->signal] = (int32_t)((raw * p_signal->multiplier + p_signal->offset) >> p_signal->fractionBits);
+		decoded |= 1UL << p_signal->signal;
+	}
+
+	return decoded;
+}
+
+/*
+ *	Public function implementations
+ */
+uint32_t signalDecoderDecode(const SignalDecodeTable_t* p_table, const uint8_t* p_buffer, uint8_t dlc,
+							 int32_t* p_values)
+{
+	if (dlc > SIGNAL_DECODER_FRAME_LENGTH_B) {
+		dlc = SIGNAL_DECODER_FRAME_LENGTH_B;
+	}
+
+	// Assemble the frame once in both byte orders, afterwards every signal is a shift and a mask
+	uint64_t words[SIGNAL_BYTE_ORDER_AMOUNT] = {0};
+	for (uint8_t i = 0; i < dlc; i++) {
+		words[SIGNAL_BYTE_ORDER_BIG_ENDIAN] |= (uint64_t)p_buffer[i] << (56 - 8 * i);
+		words[SIGNAL_BYTE_ORDER_LITTLE_ENDIAN] |= (uint64_t)p_buffer[i] << (8 * i);
+	}
+
+	uint32_t decoded = decodeGroup(&p_table->plain, words, dlc, p_values);
+
+	// Multiplexed signals are only in the frame if the multiplexor selects them
+	const SignalDescription_t* p_multiplexor = p_table->p_multiplexor;
+	if (p_multiplexor != NULL && p_multiplexor->requiredDlc <= dlc) {
+		const int64_t selected = extractRaw(p_multiplexor, words);
+		if (selected >= 0 && selected < p_table->multiplexedAmount) {
+			decoded |= decodeGroup(&p_table->p_multiplexed[selected], words, dlc, p_values);
+		}
+	}
+
+	return decoded;
+}
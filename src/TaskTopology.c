@@ -0,0 +1,280 @@
+#include "TaskTopology.h"
+
+// C includes
+#include <stdlib.h>
+#include <string.h>
+
+// espidf includes
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+
+// FreeRTOS includes
+#include "freertos/idf_additions.h"
+#include "freertos/task.h"
+
+/*
+ *	Private defines
+ */
+//! \brief Core of the TWAI driver, its interrupt and everything handling CAN frames. The main task and the esp_timer
+//! task run here as well
+#define CORE_CAN 0
+
+//! \brief Core of the rendering. Nothing else is pinned to it, so a burst of CAN frames can't delay a frame
+#define CORE_RENDER 1
+
+//! \brief Stack placement. A task whose stack is in PSRAM mustn't write the flash or NVS, both disable the cache the
+//! PSRAM is accessed through
+#define STACK_INTERNAL (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define STACK_PSRAM (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+/*
+ *	Private typedefs
+ */
+typedef struct
+{
+	const char* p_name;
+	BaseType_t core;
+	UBaseType_t priority;
+	uint32_t stackSizeB;
+	UBaseType_t stackCaps;
+} TaskDescription_t;
+
+/*
+ *	Private variables
+ */
+//! \brief Where and how every task runs. The priorities only compete within a core: the dispatcher has to empty the
+//! queue of the CAN driver before it overflows, so it preempts the managers, which preempt the flash writer. The stack
+//! sizes are what the tasks always had, the high-water marks of the task statistics tell how far they can shrink.
+//! The OS layer of LVGL 9.2 creates its draw threads without affinity and the affinity of a task can't be changed
+//! afterwards, so they render on both cores. They are adopted at priority 4, below every CAN task but the flash
+//! writer, so CAN handling on core 0 runs first instead of time-slicing with rendering. A burst only delays the share
+//! of a frame a draw thread took on core 0, the one on core 1 keeps going. The flash writer only runs during an
+//! update, which stops the GUI
+static const TaskDescription_t g_tasks[TASK_AMOUNT] = {
+	[TASK_LVGL] = {"lvglUpdateTask", CORE_RENDER, 5, 10000, STACK_INTERNAL},
+	// Only switches screens, so its stack can live in PSRAM
+	[TASK_GUI_EVENTS] = {"guiEventTask", CORE_RENDER, 4, 4096, STACK_PSRAM},
+	[TASK_CAN_DISPATCHER] = {"CanDispatcher", CORE_CAN, 7, 4096, STACK_INTERNAL},
+	// Ingests the sensor data. Stores the SPI clock profile in NVS, so its stack has to be internal
+	[TASK_OPERATION_MANAGER] = {"OperationCan", CORE_CAN, 6, 8192, STACK_INTERNAL},
+	// Deletes itself after the registration, only tasks with internal stacks can do that
+	[TASK_REGISTRATION_MANAGER] = {"RegistrationCan", CORE_CAN, 6, 8192, STACK_INTERNAL},
+	[TASK_UPDATE_MANAGER] = {"CanUpdaterTask", CORE_CAN, 5, 8192, STACK_INTERNAL},
+	// Erases and writes the flash, it keeps up as long as the update transfer doesn't stall on it
+	[TASK_UPDATE_FLASH_WRITER] = {"FlashWriterTask", CORE_CAN, 3, 4096, STACK_INTERNAL},
+	[TASK_IDLE_CORE_0] = {"IDLE0", 0, tskIDLE_PRIORITY, CONFIG_FREERTOS_IDLE_TASK_STACKSIZE, STACK_INTERNAL},
+	[TASK_IDLE_CORE_1] = {"IDLE1", 1, tskIDLE_PRIORITY, CONFIG_FREERTOS_IDLE_TASK_STACKSIZE, STACK_INTERNAL},
+	[TASK_LVGL_DRAW_0] = {"lvglDraw0", tskNO_AFFINITY, 4, CONFIG_LV_DRAW_THREAD_STACK_SIZE, STACK_INTERNAL},
+	[TASK_LVGL_DRAW_1] = {"lvglDraw1", tskNO_AFFINITY, 4, CONFIG_LV_DRAW_THREAD_STACK_SIZE, STACK_INTERNAL},
+};
+
+//! \brief Handles of the created tasks, NULL if a task doesn't exist
+static TaskHandle_t g_handles[TASK_AMOUNT] = {NULL};
+
+//! \brief Protects the handles, so the statistics never query a task which is being deleted
+static portMUX_TYPE g_handlesLock = portMUX_INITIALIZER_UNLOCKED;
+
+//! \brief CPU time and timestamp of the previous statistics call per task in us
+static uint64_t g_previousRunTimeUs[TASK_AMOUNT] = {0};
+static int64_t g_previousSampleUs[TASK_AMOUNT] = {0};
+
+/*
+ *	Private function implementations
+ */
+//! \brief Takes a snapshot of all tasks
+//! \param p_amount Where the amount of tasks is written to
+//! \retval The tasks, free them after use. NULL if the snapshot failed
+static TaskStatus_t* getTaskStates(UBaseType_t* p_amount)
+{
+	// Leave room for tasks created in the meantime
+	const UBaseType_t slots = uxTaskGetNumberOfTasks() + 4;
+	TaskStatus_t* p_states = (TaskStatus_t*)malloc(slots * sizeof(TaskStatus_t));
+	if (p_states == NULL) {
+		return NULL;
+	}
+
+	*p_amount = uxTaskGetSystemState(p_states, slots, NULL);
+	if (*p_amount == 0) {
+		free(p_states);
+
+		return NULL;
+	}
+
+	return p_states;
+}
+
+/*
+ *	Public function implementations
+ */
+uint32_t taskTopologyGetCreationMark()
+{
+	UBaseType_t amount = 0;
+	TaskStatus_t* p_states = getTaskStates(&amount);
+	if (p_states == NULL) {
+		ESP_LOGE("TaskTopology", "Couldn't take a snapshot of the tasks");
+
+		return UINT32_MAX;
+	}
+
+	// Every created task gets the next task number
+	uint32_t mark = 0;
+	for (UBaseType_t i = 0; i < amount; i++) {
+		if (p_states[i].xTaskNumber > mark) {
+			mark = p_states[i].xTaskNumber;
+		}
+	}
+
+	free(p_states);
+
+	return mark;
+}
+
+uint8_t taskTopologyAdopt(const TaskId_t firstTask, const uint8_t amount, const uint32_t mark)
+{
+	if (firstTask < TASK_LVGL_DRAW_0 || firstTask + amount > TASK_AMOUNT) {
+		ESP_LOGE("TaskTopology", "Tasks %d to %d can't be adopted", firstTask, firstTask + amount - 1);
+
+		return 0;
+	}
+
+	UBaseType_t stateAmount = 0;
+	TaskStatus_t* p_states = getTaskStates(&stateAmount);
+	if (p_states == NULL) {
+		ESP_LOGE("TaskTopology", "Couldn't take a snapshot of the tasks");
+
+		return 0;
+	}
+
+	uint8_t adopted = 0;
+	uint32_t previousNumber = mark;
+	while (adopted < amount) {
+		// The oldest task created after the previously adopted one
+		const TaskStatus_t* p_next = NULL;
+		for (UBaseType_t i = 0; i < stateAmount; i++) {
+			if (p_states[i].xTaskNumber > previousNumber &&
+				(p_next == NULL || p_states[i].xTaskNumber < p_next->xTaskNumber)) {
+				p_next = &p_states[i];
+			}
+		}
+
+		if (p_next == NULL) {
+			break;
+		}
+
+		const TaskId_t task = (TaskId_t)(firstTask + adopted);
+		vTaskPrioritySet(p_next->xHandle, g_tasks[task].priority);
+
+		taskENTER_CRITICAL(&g_handlesLock);
+		g_handles[task] = p_next->xHandle;
+		taskEXIT_CRITICAL(&g_handlesLock);
+
+		previousNumber = p_next->xTaskNumber;
+		adopted++;
+	}
+
+	free(p_states);
+
+	return adopted;
+}
+
+bool taskTopologyCreate(const TaskId_t task, const TaskFunction_t function, void* p_param, TaskHandle_t* p_handle)
+{
+	if (task >= TASK_IDLE_CORE_0 || g_handles[task] != NULL) {
+		ESP_LOGE("TaskTopology", "Task %d can't be created", task);
+
+		return false;
+	}
+
+	// The handle is written before the task can run, so it may delete itself right away
+	const TaskDescription_t* p_task = &g_tasks[task];
+	BaseType_t result;
+	if (p_task->stackCaps == STACK_INTERNAL) {
+		result = xTaskCreatePinnedToCore(function, p_task->p_name, p_task->stackSizeB, p_param, p_task->priority,
+										 &g_handles[task], p_task->core);
+	}
+	else {
+		result = xTaskCreatePinnedToCoreWithCaps(function, p_task->p_name, p_task->stackSizeB, p_param,
+												 p_task->priority, &g_handles[task], p_task->core, p_task->stackCaps);
+	}
+
+	if (result != pdPASS) {
+		ESP_LOGE("TaskTopology", "Couldn't create task \"%s\"", p_task->p_name);
+		g_handles[task] = NULL;
+
+		return false;
+	}
+
+	if (p_handle != NULL) {
+		*p_handle = g_handles[task];
+	}
+
+	return true;
+}
+
+void taskTopologyDelete(const TaskId_t task)
+{
+	if (task >= TASK_IDLE_CORE_0) {
+		return;
+	}
+
+	taskENTER_CRITICAL(&g_handlesLock);
+	const TaskHandle_t handle = g_handles[task];
+	g_handles[task] = NULL;
+	taskEXIT_CRITICAL(&g_handlesLock);
+
+	if (handle == NULL) {
+		return;
+	}
+
+	if (g_tasks[task].stackCaps == STACK_INTERNAL) {
+		vTaskDelete(handle);
+	}
+	else {
+		vTaskDeleteWithCaps(handle);
+	}
+}
+
+void taskTopologyGetStatistics(const TaskId_t task, TaskStatistics_t* p_statistics)
+{
+	if (p_statistics == NULL) {
+		return;
+	}
+
+	memset(p_statistics, 0, sizeof(TaskStatistics_t));
+	if (task >= TASK_AMOUNT) {
+		return;
+	}
+
+	const int64_t nowUs = esp_timer_get_time();
+
+	taskENTER_CRITICAL(&g_handlesLock);
+	const TaskHandle_t handle = task == TASK_IDLE_CORE_0 || task == TASK_IDLE_CORE_1
+									? xTaskGetIdleTaskHandleForCore(g_tasks[task].core)
+									: g_handles[task];
+	if (handle != NULL) {
+		p_statistics->running = true;
+		p_statistics->stackHighWaterB = uxTaskGetStackHighWaterMark(handle);
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+		// The run time counter is clocked by esp_timer, so it counts in us
+		p_statistics->runTimeUs = ulTaskGetRunTimeCounter(handle);
+#endif
+	}
+	taskEXIT_CRITICAL(&g_handlesLock);
+
+	if (!p_statistics->running) {
+		return;
+	}
+
+	p_statistics->stackSizeB = g_tasks[task].stackSizeB;
+
+	// A task which was recreated starts counting from 0 again
+	const int64_t elapsedUs = nowUs - g_previousSampleUs[task];
+	if (elapsedUs > 0 && p_statistics->runTimeUs >= g_previousRunTimeUs[task]) {
+		const uint64_t percent = (p_statistics->runTimeUs - g_previousRunTimeUs[task]) * 100 / (uint64_t)elapsedUs;
+		p_statistics->cpuPercent = percent > 100 ? 100 : (uint8_t)percent;
+	}
+
+	g_previousRunTimeUs[task] = p_statistics->runTimeUs;
+	g_previousSampleUs[task] = nowUs;
+}
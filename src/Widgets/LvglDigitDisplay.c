@@ -0,0 +1,290 @@
+#include "Widgets/LvglDigitDisplay.h"
+
+// C includes
+#include <string.h>
+
+// espidf includes
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+
+/*
+ *	Private defines
+ */
+//! \brief Amount of different glyph sets which can be cached
+#define GLYPH_SET_AMOUNT 4
+
+//! \brief Marks a blank digit cell
+#define BLANK_DIGIT (-1)
+
+/*
+ *	Prototypes
+ */
+//! \brief Renders the coverage of the digits 0-9 of a font into A8 images
+//! \param p_glyphs The glyph set to render, the font has to be set
+//! \retval Bool indicating if all digits were rendered
+static bool renderGlyphs(LvglDigitGlyphs_t* p_glyphs);
+
+//! \brief Moves the container so that the visible digits are centered at the requested position
+//! \param p_display The digit display
+static void applyAlignment(LvglDigitDisplay_t* p_display);
+
+/*
+ *	Private variables
+ */
+//! \brief The rendered glyph sets. They are never freed, every screen is resident
+static LvglDigitGlyphs_t g_glyphSets[GLYPH_SET_AMOUNT];
+static uint8_t g_glyphSetCount = 0;
+
+//! \brief The text of every digit, lv_draw_label() needs it until the layer is finished
+static const char* const g_digitTexts[10] = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"};
+
+/*
+ *	Private function implementations
+ */
+static bool renderGlyphs(LvglDigitGlyphs_t* p_glyphs)
+{
+	const lv_font_t* p_font = p_glyphs->p_font;
+	const int32_t height = lv_font_get_line_height(p_font);
+
+	// Only keep the columns any digit actually covers, the rest of the advance width is always background
+	int32_t left = INT32_MAX;
+	int32_t right = 0;
+	p_glyphs->advanceWidth = 0;
+	for (uint8_t digit = 0; digit < 10; digit++) {
+		lv_font_glyph_dsc_t glyph;
+		if (!lv_font_get_glyph_dsc(p_font, &glyph, '0' + digit, 0)) {
+			return false;
+		}
+
+		if (glyph.ofs_x < left) {
+			left = glyph.ofs_x;
+		}
+		if (glyph.ofs_x + glyph.box_w > right) {
+			right = glyph.ofs_x + glyph.box_w;
+		}
+		if (glyph.adv_w > p_glyphs->advanceWidth) {
+			p_glyphs->advanceWidth = glyph.adv_w;
+		}
+	}
+
+	const int32_t width = right - left;
+	if (width <= 0 || height <= 0) {
+		return false;
+	}
+	p_glyphs->offsetX = left;
+
+	// All masks in one block. Internal RAM, the renderer reads them every time a digit changes
+	const uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_A8);
+	const uint32_t maskSizeB = (stride * height + LV_DRAW_BUF_ALIGN - 1) & ~(uint32_t)(LV_DRAW_BUF_ALIGN - 1);
+	p_glyphs->p_masks = heap_caps_malloc(maskSizeB * 10, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (p_glyphs->p_masks == NULL) {
+		ESP_LOGW("LvglDigitDisplay", "No internal RAM for the digit masks (%lu B), using PSRAM",
+				 (unsigned long)(maskSizeB * 10));
+		p_glyphs->p_masks = heap_caps_malloc(maskSizeB * 10, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+		if (p_glyphs->p_masks == NULL) {
+			return false;
+		}
+	}
+
+	// Render every digit once with the regular label renderer, so it looks exactly like the label did. The canvas is
+	// ARGB8888 because LVGL can't render into A8, its alpha channel is the coverage
+	lv_draw_buf_t* p_canvasBuffer = lv_draw_buf_create(width, height, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+	lv_obj_t* p_canvas = p_canvasBuffer != NULL ? lv_canvas_create(lv_layer_top()) : NULL;
+	if (p_canvas == NULL) {
+		if (p_canvasBuffer != NULL) {
+			lv_draw_buf_destroy(p_canvasBuffer);
+		}
+		heap_caps_free(p_glyphs->p_masks);
+		p_glyphs->p_masks = NULL;
+		return false;
+	}
+	lv_canvas_set_draw_buf(p_canvas, p_canvasBuffer);
+
+	for (uint8_t digit = 0; digit < 10; digit++) {
+		lv_canvas_fill_bg(p_canvas, lv_color_black(), LV_OPA_TRANSP);
+
+		lv_layer_t layer;
+		lv_canvas_init_layer(p_canvas, &layer);
+
+		lv_draw_label_dsc_t labelDsc;
+		lv_draw_label_dsc_init(&labelDsc);
+		labelDsc.font = p_font;
+		labelDsc.color = lv_color_white();
+		labelDsc.text = g_digitTexts[digit];
+
+		// Shift the glyph, so the cropped columns are outside of the canvas
+		const lv_area_t area = {.x1 = -left, .y1 = 0, .x2 = p_glyphs->advanceWidth - left - 1, .y2 = height - 1};
+		lv_draw_label(&layer, &labelDsc, &area);
+
+		lv_canvas_finish_layer(p_canvas, &layer);
+
+		// Keep only the alpha channel
+		uint8_t* p_mask = p_glyphs->p_masks + digit * maskSizeB;
+		lv_draw_buf_init(&p_glyphs->digits[digit], width, height, LV_COLOR_FORMAT_A8, stride, p_mask, maskSizeB);
+		for (int32_t y = 0; y < height; y++) {
+			const lv_color32_t* p_source =
+				(const lv_color32_t*)(p_canvasBuffer->data + y * p_canvasBuffer->header.stride);
+			uint8_t* p_row = p_mask + y * stride;
+			for (int32_t x = 0; x < width; x++) {
+				p_row[x] = p_source[x].alpha;
+			}
+		}
+	}
+
+	lv_obj_delete(p_canvas);
+	lv_draw_buf_destroy(p_canvasBuffer);
+
+	return true;
+}
+
+static void applyAlignment(LvglDigitDisplay_t* p_display)
+{
+	// The blank cells are on the left, shift the container left by half of them
+	const uint8_t blankCells = p_display->digitCount - p_display->visibleDigits;
+	const int32_t shiftX = (int32_t)blankCells * p_display->p_glyphs->advanceWidth / 2;
+
+	lv_obj_align(p_display->container, p_display->align, p_display->offsetX - shiftX, p_display->offsetY);
+}
+
+/*
+ *	Public function implementations
+ */
+const LvglDigitGlyphs_t* lvglDigitGlyphsGet(const lv_font_t* p_font)
+{
+	if (p_font == NULL) {
+		return NULL;
+	}
+
+	// Reuse the glyphs if they were rendered already
+	for (uint8_t i = 0; i < g_glyphSetCount; i++) {
+		if (g_glyphSets[i].p_font == p_font) {
+			return &g_glyphSets[i];
+		}
+	}
+
+	if (g_glyphSetCount >= GLYPH_SET_AMOUNT) {
+		return NULL;
+	}
+
+	LvglDigitGlyphs_t* p_glyphs = &g_glyphSets[g_glyphSetCount];
+	memset(p_glyphs, 0, sizeof(LvglDigitGlyphs_t));
+	p_glyphs->p_font = p_font;
+
+	if (!renderGlyphs(p_glyphs)) {
+		return NULL;
+	}
+
+	g_glyphSetCount++;
+	return p_glyphs;
+}
+
+bool lvglDigitDisplayCreate(LvglDigitDisplay_t* p_display, lv_obj_t* p_parent, const LvglDigitGlyphs_t* p_glyphs,
+							const uint8_t digitCount, const lv_color_t color)
+{
+	if (p_display == NULL || p_glyphs == NULL || digitCount == 0 || digitCount > LVGL_DIGIT_DISPLAY_MAX_DIGITS) {
+		return false;
+	}
+
+	memset(p_display, 0, sizeof(LvglDigitDisplay_t));
+	p_display->p_glyphs = p_glyphs;
+	p_display->digitCount = digitCount;
+	p_display->visibleDigits = digitCount;
+	p_display->value = -1;
+	p_display->align = LV_ALIGN_CENTER;
+
+	const int32_t height = p_glyphs->digits[0].header.h;
+
+	// Plain container without background, border, padding or scrolling
+	p_display->container = lv_obj_create(p_parent);
+	lv_obj_remove_style_all(p_display->container);
+	lv_obj_remove_flag(p_display->container, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+	lv_obj_set_size(p_display->container, p_glyphs->advanceWidth * digitCount, height);
+
+	// One image per digit, all of them start blank. The masks only hold the coverage, the color comes from recoloring
+	for (uint8_t i = 0; i < digitCount; i++) {
+		p_display->cells[i] = lv_image_create(p_display->container);
+		lv_obj_set_pos(p_display->cells[i], i * p_glyphs->advanceWidth + p_glyphs->offsetX, 0);
+		lv_obj_set_style_image_recolor(p_display->cells[i], color, 0);
+		lv_obj_set_style_image_recolor_opa(p_display->cells[i], LV_OPA_COVER, 0);
+		lv_obj_add_flag(p_display->cells[i], LV_OBJ_FLAG_HIDDEN);
+		p_display->shownDigits[i] = BLANK_DIGIT;
+	}
+
+	applyAlignment(p_display);
+
+	return true;
+}
+
+void lvglDigitDisplayAlign(LvglDigitDisplay_t* p_display, const lv_align_t align, const int32_t offsetX,
+						   const int32_t offsetY)
+{
+	if (p_display == NULL || p_display->container == NULL) {
+		return;
+	}
+
+	p_display->align = align;
+	p_display->offsetX = offsetX;
+	p_display->offsetY = offsetY;
+	applyAlignment(p_display);
+}
+
+void lvglDigitDisplaySetValue(LvglDigitDisplay_t* p_display, uint32_t value)
+{
+	if (p_display == NULL || p_display->container == NULL) {
+		return;
+	}
+
+	// Clamp to what fits into the cells
+	uint32_t maxValue = 1;
+	for (uint8_t i = 0; i < p_display->digitCount; i++) {
+		maxValue *= 10;
+	}
+	if (value >= maxValue) {
+		value = maxValue - 1;
+	}
+
+	// Nothing changed, so nothing has to be redrawn
+	if ((int32_t)value == p_display->value) {
+		return;
+	}
+	p_display->value = (int32_t)value;
+
+	// Split the value into its digits, leading zeros stay blank but at least one digit is shown
+	int8_t digits[LVGL_DIGIT_DISPLAY_MAX_DIGITS];
+	uint8_t visibleDigits = 0;
+	for (int8_t i = (int8_t)p_display->digitCount - 1; i >= 0; i--) {
+		if (value > 0 || visibleDigits == 0) {
+			digits[i] = (int8_t)(value % 10);
+			visibleDigits++;
+		}
+		else {
+			digits[i] = BLANK_DIGIT;
+		}
+		value /= 10;
+	}
+
+	// Only the cells whose digit changed are touched, LVGL invalidates just their area
+	for (uint8_t i = 0; i < p_display->digitCount; i++) {
+		if (digits[i] == p_display->shownDigits[i]) {
+			continue;
+		}
+
+		if (digits[i] == BLANK_DIGIT) {
+			lv_obj_add_flag(p_display->cells[i], LV_OBJ_FLAG_HIDDEN);
+		}
+		else {
+			lv_image_set_src(p_display->cells[i], &p_display->p_glyphs->digits[digits[i]]);
+			if (p_display->shownDigits[i] == BLANK_DIGIT) {
+				lv_obj_remove_flag(p_display->cells[i], LV_OBJ_FLAG_HIDDEN);
+			}
+		}
+
+		p_display->shownDigits[i] = digits[i];
+	}
+
+	// Keep the number centered like the label was. This moves the whole number, but only when its length changes
+	if (visibleDigits != p_display->visibleDigits) {
+		p_display->visibleDigits = visibleDigits;
+		applyAlignment(p_display);
+	}
+}
@@ -0,0 +1,220 @@
+#include "Widgets/LvglSegmentRing.h"
+
+// C includes
+#include <math.h>
+#include <string.h>
+
+/*
+ *	Private defines
+ */
+//! \brief Samples per pixel and axis the coverage of the masks is computed with
+#define MASK_SUBSAMPLES 4
+
+#define DEGREES_TO_RADIANS (3.14159265f / 180.0f)
+
+/*
+ *	Prototypes
+ */
+//! \brief Computes the bounding box of a segment and renders its coverage mask
+//! \param p_ring The ring, the mask and area of the segment are written to it
+//! \param p_config The geometry of the ring
+//! \param segment Index of the segment
+//! \retval Bool indicating if the mask was rendered
+static bool renderMask(LvglSegmentRing_t* p_ring, const LvglSegmentRingConfig_t* p_config, uint8_t segment);
+
+//! \brief Draws all segments with one image draw per segment
+//! \param p_event The LVGL event
+static void drawSegments(lv_event_t* p_event);
+
+//! \brief Frees the masks together with the object
+//! \param p_event The LVGL event
+static void destroyMasks(lv_event_t* p_event);
+
+/*
+ *	Private function implementations
+ */
+static bool renderMask(LvglSegmentRing_t* p_ring, const LvglSegmentRingConfig_t* p_config, const uint8_t segment)
+{
+	const float center = (float)p_config->diameter / 2.0f;
+	const float innerRadius = center - (float)p_config->width;
+	const uint32_t startAngle = p_config->startAngle + segment * (p_config->segmentAngle + p_config->gapAngle);
+	const uint32_t endAngle = startAngle + p_config->segmentAngle;
+
+	const float startX = cosf((float)startAngle * DEGREES_TO_RADIANS);
+	const float startY = sinf((float)startAngle * DEGREES_TO_RADIANS);
+	const float endX = cosf((float)endAngle * DEGREES_TO_RADIANS);
+	const float endY = sinf((float)endAngle * DEGREES_TO_RADIANS);
+
+	// The segment is bounded by its four corners and the outermost points of the axes it crosses
+	float minX = center * startX;
+	float maxX = minX;
+	float minY = center * startY;
+	float maxY = minY;
+	const float pointsX[] = {innerRadius * startX, center * endX, innerRadius * endX};
+	const float pointsY[] = {innerRadius * startY, center * endY, innerRadius * endY};
+	for (uint8_t i = 0; i < 3; i++) {
+		minX = fminf(minX, pointsX[i]);
+		maxX = fmaxf(maxX, pointsX[i]);
+		minY = fminf(minY, pointsY[i]);
+		maxY = fmaxf(maxY, pointsY[i]);
+	}
+	for (uint32_t angle = (startAngle / 90 + 1) * 90; angle < endAngle; angle += 90) {
+		switch (angle % 360) {
+			case 0:
+				maxX = center;
+				break;
+			case 90:
+				maxY = center;
+				break;
+			case 180:
+				minX = -center;
+				break;
+			default:
+				minY = -center;
+				break;
+		}
+	}
+
+	lv_area_t* p_area = &p_ring->areas[segment];
+	p_area->x1 = LV_MAX((int32_t)floorf(center + minX), 0);
+	p_area->y1 = LV_MAX((int32_t)floorf(center + minY), 0);
+	p_area->x2 = LV_MIN((int32_t)ceilf(center + maxX), (int32_t)p_config->diameter) - 1;
+	p_area->y2 = LV_MIN((int32_t)ceilf(center + maxY), (int32_t)p_config->diameter) - 1;
+
+	lv_draw_buf_t* p_mask = lv_draw_buf_create(lv_area_get_width(p_area), lv_area_get_height(p_area),
+											   LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+	if (p_mask == NULL) {
+		return false;
+	}
+	p_ring->p_masks[segment] = p_mask;
+
+	// Coverage of every pixel, a sample is inside if it's within the annulus and between both edges of the segment
+	const float innerRadius2 = innerRadius * innerRadius;
+	const float outerRadius2 = center * center;
+	for (int32_t y = p_area->y1; y <= p_area->y2; y++) {
+		uint8_t* p_row = p_mask->data + (y - p_area->y1) * p_mask->header.stride;
+
+		for (int32_t x = p_area->x1; x <= p_area->x2; x++) {
+			uint8_t samples = 0;
+			for (uint8_t sampleY = 0; sampleY < MASK_SUBSAMPLES; sampleY++) {
+				const float pointY = (float)y + ((float)sampleY + 0.5f) / MASK_SUBSAMPLES - center;
+				for (uint8_t sampleX = 0; sampleX < MASK_SUBSAMPLES; sampleX++) {
+					const float pointX = (float)x + ((float)sampleX + 0.5f) / MASK_SUBSAMPLES - center;
+					const float radius2 = pointX * pointX + pointY * pointY;
+					if (radius2 >= innerRadius2 && radius2 <= outerRadius2 && startX * pointY - startY * pointX >= 0 &&
+						pointX * endY - pointY * endX >= 0) {
+						samples++;
+					}
+				}
+			}
+
+			p_row[x - p_area->x1] = (uint8_t)(samples * 255 / (MASK_SUBSAMPLES * MASK_SUBSAMPLES));
+		}
+	}
+
+	return true;
+}
+
+static void drawSegments(lv_event_t* p_event)
+{
+	const LvglSegmentRing_t* p_ring = lv_event_get_user_data(p_event);
+	lv_layer_t* p_layer = lv_event_get_layer(p_event);
+
+	lv_area_t coords;
+	lv_obj_get_coords(p_ring->obj, &coords);
+
+	// The masks only hold the coverage, the color comes from the recoloring
+	lv_draw_image_dsc_t imageDsc;
+	lv_draw_image_dsc_init(&imageDsc);
+	imageDsc.recolor_opa = LV_OPA_COVER;
+
+	for (uint8_t i = 0; i < p_ring->segmentCount; i++) {
+		lv_area_t area = p_ring->areas[i];
+		lv_area_move(&area, coords.x1, coords.y1);
+
+		imageDsc.src = p_ring->p_masks[i];
+		imageDsc.recolor = i < p_ring->litSegments ? p_ring->colors[i] : p_ring->offColor;
+		lv_draw_image(p_layer, &imageDsc, &area);
+	}
+}
+
+static void destroyMasks(lv_event_t* p_event)
+{
+	LvglSegmentRing_t* p_ring = lv_event_get_user_data(p_event);
+
+	for (uint8_t i = 0; i < LVGL_SEGMENT_RING_MAX_SEGMENTS; i++) {
+		if (p_ring->p_masks[i] != NULL) {
+			lv_draw_buf_destroy(p_ring->p_masks[i]);
+			p_ring->p_masks[i] = NULL;
+		}
+	}
+	p_ring->obj = NULL;
+}
+
+/*
+ *	Public function implementations
+ */
+bool lvglSegmentRingCreate(LvglSegmentRing_t* p_ring, lv_obj_t* p_parent, const LvglSegmentRingConfig_t* p_config)
+{
+	// The edge test of the masks only works for segments below 180°
+	if (p_ring == NULL || p_config == NULL || p_config->p_colors == NULL || p_config->segmentCount == 0 ||
+		p_config->segmentCount > LVGL_SEGMENT_RING_MAX_SEGMENTS || p_config->segmentAngle == 0 ||
+		p_config->segmentAngle >= 180 || p_config->width == 0 || p_config->width * 2 > p_config->diameter) {
+		return false;
+	}
+
+	memset(p_ring, 0, sizeof(LvglSegmentRing_t));
+	p_ring->segmentCount = p_config->segmentCount;
+	p_ring->litSegments = p_config->segmentCount;
+	p_ring->offColor = p_config->offColor;
+	memcpy(p_ring->colors, p_config->p_colors, p_config->segmentCount * sizeof(lv_color_t));
+
+	for (uint8_t i = 0; i < p_config->segmentCount; i++) {
+		if (!renderMask(p_ring, p_config, i)) {
+			for (uint8_t j = 0; j < i; j++) {
+				lv_draw_buf_destroy(p_ring->p_masks[j]);
+				p_ring->p_masks[j] = NULL;
+			}
+			return false;
+		}
+	}
+
+	// Plain object without styles, it is neither clicked nor scrolled and only draws the segments
+	p_ring->obj = lv_obj_create(p_parent);
+	lv_obj_remove_style_all(p_ring->obj);
+	lv_obj_remove_flag(p_ring->obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+	lv_obj_set_size(p_ring->obj, p_config->diameter, p_config->diameter);
+	lv_obj_add_event_cb(p_ring->obj, drawSegments, LV_EVENT_DRAW_MAIN, p_ring);
+	lv_obj_add_event_cb(p_ring->obj, destroyMasks, LV_EVENT_DELETE, p_ring);
+
+	return true;
+}
+
+void lvglSegmentRingSetLit(LvglSegmentRing_t* p_ring, uint8_t litSegments)
+{
+	if (p_ring == NULL || p_ring->obj == NULL) {
+		return;
+	}
+
+	if (litSegments > p_ring->segmentCount) {
+		litSegments = p_ring->segmentCount;
+	}
+
+	// Nothing changed, so nothing has to be redrawn
+	if (litSegments == p_ring->litSegments) {
+		return;
+	}
+
+	// Only the segments between the old and the new amount change their color
+	lv_area_t coords;
+	lv_obj_get_coords(p_ring->obj, &coords);
+	const uint8_t first = LV_MIN(litSegments, p_ring->litSegments);
+	const uint8_t last = LV_MAX(litSegments, p_ring->litSegments);
+	for (uint8_t i = first; i < last; i++) {
+		lv_area_t area = p_ring->areas[i];
+		lv_area_move(&area, coords.x1, coords.y1);
+		lv_obj_invalidate_area(p_ring->obj, &area);
+	}
+
+	p_ring->litSegments = litSegments;
+}
@@ -1,5 +1,6 @@
 // Project includes
-#include "EventQueues.h"
+#include "CanDispatcher.h"
+#include "EventBus.h"
 #include "GUI.h"
 #include "Version.h"
 #include "can.h"
@@ -12,6 +13,7 @@
 #include <esp_log.h>
 #include <esp_ota_ops.h>
 #include <esp_partition.h>
+#include <nvs_flash.h>
 
 /*
  *	Main function
@@ -39,21 +41,35 @@ void app_main(void) // NOLINT
 	/*
 	 *	Initialization of Drivers etc.
 	 */
-	// Event Queues
-	createEventQueues();
+	// Event bus
+	eventBusInit();
+
+	// NVS, holds the display settings. A partition of an older layout is erased, it only holds settings
+	esp_err_t nvsResult = nvs_flash_init();
+	if (nvsResult == ESP_ERR_NVS_NO_FREE_PAGES || nvsResult == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+		nvs_flash_erase();
+		nvsResult = nvs_flash_init();
+	}
+	if (nvsResult != ESP_OK) {
+		ESP_LOGE("main", "Couldn't initialize NVS, using the default settings");
+	}
 
 	// CAN
 	canInitializeNode(GPIO_NUM_9, GPIO_NUM_6);
 	canEnableNode();
 
+	// Route the received CAN frames to the managers
+	canDispatcherInit();
+
 	// GUI
 	guiInit();
 
 	/*
 	 *	Other preparations
 	 */
-	// Register the queue to the CAN bus
-	canRegisterRxCbQueue(&g_mainQueue);
+	// Subscribe to the restart message of the master
+	const uint8_t messageIds[] = {CAN_MSG_DISPLAY_RESTART};
+	canDispatcherSubscribe(EVENT_BUS_CHANNEL_OF(MAIN, CanMessage_t), messageIds, sizeof(messageIds), CAN_SENDER_MASTER);
 
 	/*
 	 *	Initialization of the registration manager
@@ -61,45 +77,22 @@ void app_main(void) // NOLINT
 	registrationManagerInit();
 
 	// Wait for new queue events
-	QueueEvent_t queueEvent;
+	CanMessage_t message;
 	while (true) {
-		// Wait until we get a new event in the queue
-		if (xQueueReceive(g_mainQueue, &queueEvent, portMAX_DELAY) != pdPASS) {
-			continue;
-		}
-
-		// Skip if it's not a new can frame, or it's not from the master
-		if (queueEvent.command != RECEIVED_NEW_CAN_FRAME || (queueEvent.frameId & 0x1FFFFF) != 0) {
-			continue;
-		}
-
-		// Get the frame id
-		const uint8_t frameId = queueEvent.frameId >> CAN_FRAME_ID_OFFSET;
-
-		// The CAN driver crashed
-		if (queueEvent.command == CAN_DRIVER_CRASHED) {
-			if (canRecoverDriver() == ESP_OK) {
-				ESP_LOGI("main", "Recovered CAN driver");
-
-				continue;
-			}
-
-			ESP_LOGE("main", "Couldn't recover CAN driver");
-
+		// Wait until we get a new message in the queue
+		if (!EVENT_BUS_RECEIVE(MAIN, &message, portMAX_DELAY)) {
 			continue;
 		}
 
 		// Should we restart?
-		if (frameId == CAN_MSG_DISPLAY_RESTART) {
+		if (message.messageId == CAN_MSG_DISPLAY_RESTART) {
 			// Were we meant?
-			if (queueEvent.frameBuffer[0] != g_ownCanComId) {
+			if (message.dlc == 0 || message.buffer[0] != g_ownCanComId) {
 				continue;
 			}
 
 			esp_rom_printf("Restarting\n");
 			esp_restart();
 		}
-
-		break;
 	}
 }
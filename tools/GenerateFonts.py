@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+"""Converts the fonts of the screens into glyph atlases with exactly the glyphs they need.
+
+    GenerateFonts.py <Fonts.json> <output dir> --converter lv_font_conv --cache-line 32
+
+Every font of the description is rasterized with lv_font_conv from its TTF. The glyphs are then repacked:
+
+- the digits come first, so FontAtlas.c finds them by direct indexing instead of searching the cmaps. The E1234 digits
+  are rendered once by LvglDigitDisplay, so at runtime this only speeds up the VCR_OSD_MONO labels
+- the bitmaps are only padded where a glyph would touch more cache lines than its size needs, and the atlas starts at a
+  cache line, so drawing a glyph reads as few flash cache lines as possible
+
+creates <name>.c with the lv_font_t <name>_FONT per font and Fonts.h declaring all of them.
+
+The output is checked in to res/fonts/c for builds without lv_font_conv. Regenerate it after changing Fonts.json:
+
+    GenerateFonts.py res/fonts/Fonts.json res/fonts/c --cache-line 32
+"""
+
+import argparse
+import json
+import re
+import subprocess
+import sys
+import tempfile
+from dataclasses import dataclass
+from pathlib import Path
+
+BYTES_PER_LINE = 16
+DIGITS = "0123456789"
+
+GLYPH_COMMENT_PATTERN = re.compile(r"/\* U\+([0-9A-F]+) ")
+BYTE_PATTERN = re.compile(r"0x([0-9a-fA-F]{1,2})")
+GLYPH_DSC_PATTERN = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                               r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}")
+FONT_FIELD_PATTERN = re.compile(r"\.(line_height|base_line|underline_position|underline_thickness|bpp) = (-?\d+)")
+
+
+@dataclass
+class Glyph:
+    code_point: int
+    adv_w: int
+    box_w: int
+    box_h: int
+    ofs_x: int
+    ofs_y: int
+    bitmap: bytes
+
+
+@dataclass
+class Font:
+    name: str
+    source: str
+    size: int
+    bpp: int
+    glyphs: list
+    line_height: int = 0
+    base_line: int = 0
+    underline_position: int = 0
+    underline_thickness: int = 0
+
+
+def section(text, start):
+    """Returns the text of the array starting with the given declaration."""
+    begin = text.index(start)
+    return text[begin:text.index("};", begin)]
+
+
+def parse_converted(text, name, source, size):
+    """Parses the C output of lv_font_conv, the glyph ids follow the order of the bitmaps."""
+    bitmap_section = section(text, "glyph_bitmap[]")
+    code_points = [int(match, 16) for match in GLYPH_COMMENT_PATTERN.findall(bitmap_section)]
+    bitmap = bytes(int(match, 16) for match in BYTE_PATTERN.findall(bitmap_section.split("=", 1)[1]))
+
+    descriptions = [tuple(map(int, match)) for match in GLYPH_DSC_PATTERN.findall(section(text, "glyph_dsc[]"))]
+    # Glyph id 0 is reserved
+    descriptions = descriptions[1:]
+    if len(descriptions) != len(code_points):
+        raise ValueError(f"{len(code_points)} bitmaps but {len(descriptions)} glyph descriptions")
+
+    fields = {key: int(value) for key, value in FONT_FIELD_PATTERN.findall(text)}
+    font = Font(name=name, source=source, size=size, bpp=fields["bpp"], glyphs=[],
+                line_height=fields["line_height"], base_line=fields["base_line"],
+                underline_position=fields.get("underline_position", 0),
+                underline_thickness=fields.get("underline_thickness", 0))
+
+    for index, (code_point, description) in enumerate(zip(code_points, descriptions)):
+        start = description[0]
+        end = descriptions[index + 1][0] if index + 1 < len(descriptions) else len(bitmap)
+        font.glyphs.append(Glyph(code_point, *description[1:], bitmap=bitmap[start:end]))
+
+    return font
+
+
+def convert(converter, description, base_dir, name):
+    """Rasterizes one font of the description with lv_font_conv."""
+    source = base_dir / description["font"]
+    symbols = description["symbols"]
+    if len(set(symbols)) != len(symbols):
+        raise ValueError("symbols contain duplicates")
+
+    with tempfile.TemporaryDirectory() as directory:
+        output = Path(directory) / f"{name}.c"
+        command = [*converter, "--bpp", str(description.get("bpp", 1)), "--size", str(description["size"]),
+                   "--no-compress", "--no-kerning", "--font", str(source), "--symbols", symbols, "--format", "lvgl",
+                   "-o", str(output)]
+        result = subprocess.run(command, capture_output=True, text=True)
+        if result.returncode != 0:
+            raise ValueError(f"lv_font_conv failed: {result.stderr.strip()}")
+
+        font = parse_converted(output.read_text(encoding="utf-8"), name, source.name, description["size"])
+
+    missing = set(map(ord, symbols)) - {glyph.code_point for glyph in font.glyphs}
+    if missing:
+        raise ValueError(f"{source.name} has no glyphs for {''.join(sorted(map(chr, missing)))}")
+
+    return font
+
+
+def order_glyphs(font):
+    """Puts the digits first, all other glyphs follow sorted by code point."""
+    digits = [glyph for glyph in font.glyphs if chr(glyph.code_point) in DIGITS]
+    has_digits = len(digits) == len(DIGITS)
+    if not has_digits:
+        digits = []
+    else:
+        digits.sort(key=lambda glyph: glyph.code_point)
+
+    others = sorted((glyph for glyph in font.glyphs if glyph not in digits), key=lambda glyph: glyph.code_point)
+    return digits, others
+
+
+def pack(glyphs, cache_line):
+    """Returns the atlas and the offset of every glyph in it."""
+    atlas = bytearray()
+    offsets = []
+    for glyph in glyphs:
+        size = len(glyph.bitmap)
+        needed_lines = (size + cache_line - 1) // cache_line
+        touched_lines = (len(atlas) % cache_line + size + cache_line - 1) // cache_line
+        if size > 0 and touched_lines > needed_lines:
+            atlas += bytes(cache_line - len(atlas) % cache_line)
+
+        offsets.append(len(atlas))
+        atlas += glyph.bitmap
+
+    return bytes(atlas), offsets
+
+
+def describe_glyph(glyph):
+    character = chr(glyph.code_point)
+    return f"U+{glyph.code_point:04X} \"{character}\"" if character.isprintable() else f"U+{glyph.code_point:04X}"
+
+
+def generate_source(font, cache_line):
+    digits, others = order_glyphs(font)
+    glyphs = digits + others
+    atlas, offsets = pack(glyphs, cache_line)
+    padding = len(atlas) - sum(len(glyph.bitmap) for glyph in glyphs)
+
+    lines = [
+        f"// Generated by {Path(__file__).name} from {font.source} at {font.size} px, don't edit\n",
+        "#include \"Fonts.h\"\n\n",
+        "// Project includes\n",
+        "#include \"FontAtlas.h\"\n\n",
+        "/*\n *\tPrivate variables\n */\n",
+        f"//! \\brief The bitmaps of all glyphs, {len(atlas)} B of which {padding} B keep glyphs within their cache lines\n",
+        f"static const LV_ATTRIBUTE_LARGE_CONST uint8_t g_atlas[] __attribute__((aligned({cache_line}))) = {{\n",
+    ]
+    for glyph, offset, next_offset in zip(glyphs, offsets, offsets[1:] + [len(atlas)]):
+        lines.append(f"\t// {describe_glyph(glyph)}\n")
+        data = atlas[offset:next_offset]
+        for start in range(0, len(data), BYTES_PER_LINE):
+            chunk = data[start:start + BYTES_PER_LINE]
+            lines.append("\t" + ", ".join(f"0x{byte:02X}" for byte in chunk) + ",\n")
+    lines.append("};\n\n")
+
+    lines += [
+        "//! \\brief Glyph id 0 is reserved, the digits start at 1 if the font has all of them\n",
+        "static const lv_font_fmt_txt_glyph_dsc_t g_glyphs[] = {\n",
+        "\t{.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},\n",
+    ]
+    for glyph, offset in zip(glyphs, offsets):
+        lines.append(f"\t{{.bitmap_index = {offset}, .adv_w = {glyph.adv_w}, .box_w = {glyph.box_w}, "
+                     f".box_h = {glyph.box_h}, .ofs_x = {glyph.ofs_x}, .ofs_y = {glyph.ofs_y}}}, "
+                     f"// {describe_glyph(glyph)}\n")
+    lines.append("};\n")
+
+    if others:
+        lines += [
+            "\n//! \\brief Glyph ids of everything but the digits, sorted by code point\n",
+            "static const FontAtlasGlyph_t g_otherGlyphs[] = {\n",
+        ]
+        for index, glyph in enumerate(others):
+            lines.append(f"\t{{0x{glyph.code_point:04X}, {len(digits) + index + 1}}}, // {describe_glyph(glyph)}\n")
+        lines.append("};\n")
+
+    lines += [
+        "\nstatic const FontAtlas_t g_fontAtlas = {\n",
+        "\t.base =\n",
+        "\t\t{\n",
+        "\t\t\t.glyph_bitmap = g_atlas,\n",
+        "\t\t\t.glyph_dsc = g_glyphs,\n",
+        "\t\t\t.cmaps = NULL,\n",
+        "\t\t\t.kern_dsc = NULL,\n",
+        "\t\t\t.kern_scale = 0,\n",
+        "\t\t\t.cmap_num = 0,\n",
+        f"\t\t\t.bpp = {font.bpp},\n",
+        "\t\t\t.kern_classes = 0,\n",
+        "\t\t\t.bitmap_format = 0,\n",
+        "\t\t},\n",
+        f"\t.glyphAmount = {len(glyphs) + 1},\n",
+        f"\t.bitmapSizeB = {len(atlas)},\n",
+        f"\t.firstDigitGlyph = {1 if digits else 0},\n",
+        f"\t.p_otherGlyphs = {'g_otherGlyphs' if others else 'NULL'},\n",
+        f"\t.otherGlyphAmount = {len(others)},\n",
+        "};\n",
+        "\n/*\n *\tPublic variables\n */\n",
+        f"const lv_font_t {font.name}_FONT = {{\n",
+        "\t.get_glyph_dsc = fontAtlasGetGlyphDsc,\n",
+        "\t.get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,\n",
+        f"\t.line_height = {font.line_height},\n",
+        f"\t.base_line = {font.base_line},\n",
+        "\t.subpx = LV_FONT_SUBPX_NONE,\n",
+        f"\t.underline_position = {font.underline_position},\n",
+        f"\t.underline_thickness = {font.underline_thickness},\n",
+        "\t.dsc = &g_fontAtlas,\n",
+        "\t.fallback = NULL,\n",
+        "\t.user_data = NULL,\n",
+        "};\n",
+    ]
+
+    return "".join(lines)
+
+
+def generate_header(fonts, descriptions):
+    lines = [f"// Generated by {Path(__file__).name}, don't edit\n",
+             "#pragma once\n\n",
+             "// LVGL include\n",
+             "#include \"lvgl.h\"\n\n",
+             "/*\n *\tPublic variables\n */\n"]
+    for font in fonts:
+        symbols = descriptions[font.name]["symbols"]
+        lines.append(f"//! \\brief {font.source} at {font.size} px with {symbols}\n")
+        lines.append(f"extern const lv_font_t {font.name}_FONT;\n")
+
+    return "".join(lines)
+
+
+def write_if_changed(path, content):
+    # Only touch the files if they changed, otherwise everything including them is rebuilt
+    if not path.exists() or path.read_text(encoding="utf-8") != content:
+        path.write_text(content, encoding="utf-8")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("description", type=Path, help="the font description, paths are relative to it")
+    parser.add_argument("output", type=Path, help="directory the sources and Fonts.h are written to")
+    parser.add_argument("--converter", default="lv_font_conv", help="command running lv_font_conv")
+    parser.add_argument("--cache-line", type=int, default=32, help="size of a flash cache line in bytes")
+    arguments = parser.parse_args()
+
+    descriptions = json.loads(arguments.description.read_text(encoding="utf-8"))
+    fonts = []
+    for name, description in descriptions.items():
+        try:
+            font = convert(arguments.converter.split(), description, arguments.description.parent, name)
+        except (ValueError, KeyError, OSError) as error:
+            print(f"{arguments.description}: {name}: {error}", file=sys.stderr)
+            return 1
+        fonts.append(font)
+
+    arguments.output.mkdir(parents=True, exist_ok=True)
+    for font in fonts:
+        write_if_changed(arguments.output / f"{font.name}.c", generate_source(font, arguments.cache_line))
+    write_if_changed(arguments.output / "Fonts.h", generate_header(fonts, descriptions))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
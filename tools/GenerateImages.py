@@ -0,0 +1,314 @@
+#!/usr/bin/env python3
+"""Converts PNG images into LVGL image descriptors in the smallest format that keeps them intact.
+
+    GenerateImages.py <output dir> <image.png>... [--format leftIndicator=RGB565A8]
+
+creates one <name>.c per image with the lv_image_dsc_t <name> and Images.h declaring all of them. The format is picked
+per image unless it is given with --format:
+
+- A8 if all visible pixels share one color. Only the coverage is stored and the image has to be recolored with the
+  IMAGE_<NAME>_COLOR of Images.h, which also lets screens change its color for free
+- I1, I2, I4 or I8 if the image has at most 256 different colors
+- RGB565, or RGB565A8 if it is transparent, otherwise
+
+Nothing is compressed. The image cache of LVGL is disabled, so a compressed image would be decoded on every draw.
+Only the standard library is used, so no extra packages have to be installed into the IDF environment.
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+# Largest difference of a color channel to the mean color which still counts as one color
+SINGLE_COLOR_TOLERANCE = 12
+
+INDEXED_FORMATS = {"I1": 1, "I2": 2, "I4": 4, "I8": 8}
+FORMATS = ["A8", *INDEXED_FORMATS, "RGB565", "RGB565A8"]
+
+BYTES_PER_LINE = 16
+
+
+class Image:
+    def __init__(self, name, width, height, pixels):
+        self.name = name
+        self.width = width
+        self.height = height
+        # Rows of (red, green, blue, alpha)
+        self.pixels = pixels
+
+    @property
+    def macro_name(self):
+        return re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", self.name).upper()
+
+    def visible(self):
+        return [pixel for row in self.pixels for pixel in row if pixel[3] > 0]
+
+    def is_opaque(self):
+        return all(pixel[3] == 255 for row in self.pixels for pixel in row)
+
+    def single_color(self):
+        """Returns the color of all visible pixels weighted by their alpha, None if they differ."""
+        visible = self.visible()
+        if not visible:
+            return 0, 0, 0
+
+        weight = sum(pixel[3] for pixel in visible)
+        color = tuple(round(sum(pixel[channel] * pixel[3] for pixel in visible) / weight) for channel in range(3))
+        for pixel in visible:
+            if any(abs(pixel[channel] - color[channel]) > SINGLE_COLOR_TOLERANCE for channel in range(3)):
+                return None
+
+        return color
+
+    def palette(self):
+        """Returns the different colors, the most frequent one first. Fully transparent pixels are one color."""
+        counts = {}
+        for row in self.pixels:
+            for pixel in row:
+                pixel = pixel if pixel[3] > 0 else (0, 0, 0, 0)
+                counts[pixel] = counts.get(pixel, 0) + 1
+
+        return sorted(counts, key=lambda pixel: -counts[pixel])
+
+
+def load_png(path):
+    """Decodes non-interlaced 8 bit grayscale, RGB, palette and alpha PNGs."""
+    data = path.read_bytes()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError("not a PNG")
+
+    position = len(PNG_SIGNATURE)
+    compressed = b""
+    palette = []
+    transparency = b""
+    header = None
+    while position < len(data):
+        length, kind = struct.unpack(">I4s", data[position:position + 8])
+        chunk = data[position + 8:position + 8 + length]
+        position += 12 + length
+
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            transparency = chunk
+        elif kind == b"IDAT":
+            compressed += chunk
+        elif kind == b"IEND":
+            break
+
+    if header is None:
+        raise ValueError("IHDR is missing")
+
+    width, height, bit_depth, color_type, _, _, interlace = header
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if bit_depth != 8 or channels is None or interlace != 0:
+        raise ValueError("only non-interlaced 8 bit images are supported")
+
+    raw = zlib.decompress(compressed)
+    stride = width * channels
+    previous = bytearray(stride)
+    pixels = []
+    for y in range(height):
+        offset = y * (stride + 1)
+        line_filter = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        for x in range(stride):
+            left = line[x - channels] if x >= channels else 0
+            up = previous[x]
+            up_left = previous[x - channels] if x >= channels else 0
+            if line_filter == 1:
+                line[x] = (line[x] + left) & 0xFF
+            elif line_filter == 2:
+                line[x] = (line[x] + up) & 0xFF
+            elif line_filter == 3:
+                line[x] = (line[x] + (left + up) // 2) & 0xFF
+            elif line_filter == 4:
+                estimate = left + up - up_left
+                distances = abs(estimate - left), abs(estimate - up), abs(estimate - up_left)
+                predictor = left if distances[0] <= distances[1] and distances[0] <= distances[2] else \
+                    up if distances[1] <= distances[2] else up_left
+                line[x] = (line[x] + predictor) & 0xFF
+
+        row = []
+        for x in range(width):
+            values = line[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                row.append((values[0], values[0], values[0], 255))
+            elif color_type == 2:
+                row.append((*values, 255))
+            elif color_type == 3:
+                alpha = transparency[values[0]] if values[0] < len(transparency) else 255
+                row.append((*palette[values[0]], alpha))
+            elif color_type == 4:
+                row.append((values[0], values[0], values[0], values[1]))
+            else:
+                row.append(tuple(values))
+        pixels.append(row)
+        previous = line
+
+    return Image(path.stem, width, height, pixels)
+
+
+def choose_format(image):
+    if image.single_color() is not None:
+        return "A8"
+
+    colors = len(image.palette())
+    for name, bits in INDEXED_FORMATS.items():
+        if colors <= 1 << bits:
+            return name
+
+    return "RGB565" if image.is_opaque() else "RGB565A8"
+
+
+def rgb565(pixel):
+    red, green, blue = pixel[:3]
+    return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3)
+
+
+def encode(image, image_format):
+    """Returns the stride and pixel data of the image in the format LVGL expects."""
+    if image_format == "A8":
+        data = bytes(pixel[3] for row in image.pixels for pixel in row)
+        return image.width, data
+
+    if image_format in INDEXED_FORMATS:
+        bits = INDEXED_FORMATS[image_format]
+        palette = image.palette()
+        if len(palette) > 1 << bits:
+            raise ValueError(f"{len(palette)} colors don't fit into {image_format}")
+
+        # The palette is lv_color32_t, blue first, followed by the indices with the first pixel in the highest bits
+        palette += [(0, 0, 0, 0)] * ((1 << bits) - len(palette))
+        data = bytearray()
+        for red, green, blue, alpha in palette:
+            data += bytes((blue, green, red, alpha))
+
+        indices = {color: index for index, color in enumerate(palette)}
+        stride = (image.width * bits + 7) // 8
+        for row in image.pixels:
+            line = bytearray(stride)
+            for x, pixel in enumerate(row):
+                index = indices[pixel if pixel[3] > 0 else (0, 0, 0, 0)]
+                bit = x * bits
+                line[bit // 8] |= index << (8 - bits - bit % 8)
+            data += line
+        return stride, bytes(data)
+
+    # RGB565 is stored little endian, RGB565A8 has the alpha plane behind the colors
+    data = bytearray()
+    for row in image.pixels:
+        for pixel in row:
+            data += struct.pack("<H", rgb565(pixel))
+    if image_format == "RGB565A8":
+        data += bytes(pixel[3] for row in image.pixels for pixel in row)
+    return image.width * 2, bytes(data)
+
+
+def generate_source(image, image_format):
+    stride, data = encode(image, image_format)
+    data_name = f"g_{image.name}Data"
+
+    lines = [f"// Generated by {Path(__file__).name} from {image.name}.png, don't edit\n",
+             "#include \"Images.h\"\n\n"]
+    if image_format == "A8":
+        lines.append(f"// {image_format}, has to be recolored with IMAGE_{image.macro_name}_COLOR\n")
+    else:
+        lines.append(f"// {image_format}\n")
+    lines.append(f"static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t {data_name}[] = {{\n")
+    for offset in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[offset:offset + BYTES_PER_LINE]
+        lines.append("\t" + ", ".join(f"0x{byte:02X}" for byte in chunk) + ",\n")
+    lines += [
+        "};\n\n",
+        f"const lv_image_dsc_t {image.name} = {{\n",
+        "\t.header.magic = LV_IMAGE_HEADER_MAGIC,\n",
+        f"\t.header.cf = LV_COLOR_FORMAT_{image_format},\n",
+        f"\t.header.w = {image.width},\n",
+        f"\t.header.h = {image.height},\n",
+        f"\t.header.stride = {stride},\n",
+        f"\t.data_size = sizeof({data_name}),\n",
+        f"\t.data = {data_name},\n",
+        "};\n",
+    ]
+
+    return "".join(lines)
+
+
+def generate_header(images, formats):
+    lines = [f"// Generated by {Path(__file__).name}, don't edit\n",
+             "#pragma once\n\n",
+             "// LVGL include\n",
+             "#include \"lvgl.h\"\n"]
+
+    masks = [image for image in images if formats[image.name] == "A8"]
+    if masks:
+        lines.append("\n/*\n *\tPublic defines\n */\n")
+        for image in masks:
+            red, green, blue = image.single_color() or (0, 0, 0)
+            lines.append(f"//! \\brief Color of {image.name}, it only stores the coverage and has to be recolored\n")
+            lines.append(f"#define IMAGE_{image.macro_name}_COLOR 0x{red:02X}{green:02X}{blue:02X}\n")
+
+    lines.append("\n/*\n *\tPublic variables\n */\n")
+    for image in images:
+        lines.append(f"//! \\brief {image.name}.png, {image.width}x{image.height} {formats[image.name]}\n")
+        lines.append(f"extern const lv_image_dsc_t {image.name};\n")
+
+    return "".join(lines)
+
+
+def write_if_changed(path, content):
+    # Only touch the files if they changed, otherwise everything including them is rebuilt
+    if not path.exists() or path.read_text() != content:
+        path.write_text(content)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("output", type=Path, help="directory the sources and Images.h are written to")
+    parser.add_argument("images", type=Path, nargs="+", help="the PNG images, the file name is the variable name")
+    parser.add_argument("--format", action="append", default=[], metavar="NAME=FORMAT",
+                        help=f"forces the format of an image, one of {', '.join(FORMATS)}")
+    arguments = parser.parse_args()
+
+    forced = {}
+    for entry in arguments.format:
+        name, _, image_format = entry.partition("=")
+        if image_format not in FORMATS:
+            print(f"unknown format '{image_format}' for {name}", file=sys.stderr)
+            return 1
+        forced[name] = image_format
+
+    images = []
+    formats = {}
+    for path in sorted(arguments.images):
+        try:
+            image = load_png(path)
+            if not image.name.isidentifier():
+                raise ValueError("the file name has to be a valid C identifier")
+            formats[image.name] = forced.get(image.name) or choose_format(image)
+            if formats[image.name] == "A8" and image.single_color() is None:
+                raise ValueError("A8 needs an image with a single color")
+            source = generate_source(image, formats[image.name])
+        except (ValueError, zlib.error) as error:
+            print(f"{path}: {error}", file=sys.stderr)
+            return 1
+
+        images.append(image)
+        arguments.output.mkdir(parents=True, exist_ok=True)
+        write_if_changed(arguments.output / f"{image.name}.c", source)
+
+    write_if_changed(arguments.output / "Images.h", generate_header(images, formats))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
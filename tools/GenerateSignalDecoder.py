@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+"""Generates the decode tables of a CAN frame from a DBC signal description.
+
+Only the parts of DBC the display board needs are understood: one BO_ with its SG_ lines and the CM_ SG_ comments.
+Both byte orders, signed signals, scaling, offsets and one multiplexor are supported. Everything else is ignored, so
+the file can still be edited with the usual DBC tools.
+
+    GenerateSignalDecoder.py <description.dbc> <output dir> --name SensorSignal
+
+creates SensorSignals.h with the SensorSignal_t enum and SensorSignals.c with g_sensorSignalDecodeTable.
+"""
+
+import argparse
+import re
+import sys
+from dataclasses import dataclass
+from fractions import Fraction
+from pathlib import Path
+
+FRAME_LENGTH_B = 8
+MAX_SIGNALS = 32  # The decoder returns a bit mask of the decoded signals
+MAX_SIGNAL_LENGTH = 32  # Decoded values are int32_t
+MAX_FRACTION_BITS = 32
+MAX_MULTIPLEXOR_VALUE = 255
+
+MESSAGE_PATTERN = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)")
+SIGNAL_PATTERN = re.compile(
+    r"^SG_\s+(\w+)\s*(M|m\d+)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*"
+    r"\(([^,]+),([^)]+)\)\s*\[([^|]+)\|([^\]]+)\]\s*\"([^\"]*)\"")
+COMMENT_PATTERN = re.compile(r"^CM_\s+SG_\s+\d+\s+(\w+)\s+\"([^\"]*)\"\s*;")
+
+
+@dataclass
+class Signal:
+    name: str
+    start_bit: int
+    length: int
+    big_endian: bool
+    signed: bool
+    factor: Fraction
+    offset: Fraction
+    unit: str
+    is_multiplexor: bool = False
+    multiplexed_by: int | None = None
+    comment: str = ""
+
+    @property
+    def enum_name(self):
+        return re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", self.name).upper()
+
+    def placement(self):
+        """Returns the shift of the least significant bit in the frame word and the required dlc."""
+        if self.big_endian:
+            # DBC counts the start bit of big endian signals at the most significant bit, byte by byte
+            msb = (FRAME_LENGTH_B - 1 - self.start_bit // 8) * 8 + self.start_bit % 8
+            shift = msb - self.length + 1
+            last_byte = FRAME_LENGTH_B - 1 - shift // 8
+        else:
+            shift = self.start_bit
+            last_byte = (self.start_bit + self.length - 1) // 8
+
+        if shift < 0 or shift + self.length > FRAME_LENGTH_B * 8:
+            raise ValueError(f"signal {self.name} doesn't fit into the frame")
+
+        return shift, last_byte + 1
+
+    def fixed_point(self):
+        """Returns the fraction bits, multiplier and offset of the scaling."""
+        # Use as many fraction bits as the multiplier allows, integer factors stay exact with none
+        fraction_bits = 0
+        if self.factor.denominator != 1:
+            fraction_bits = MAX_FRACTION_BITS
+            while fraction_bits > 0 and abs(self.factor) * (1 << fraction_bits) >= (1 << 31):
+                fraction_bits -= 1
+
+        multiplier = round(self.factor * (1 << fraction_bits))
+        if multiplier == 0 or abs(multiplier) >= (1 << 31):
+            raise ValueError(f"factor of signal {self.name} can't be represented")
+
+        offset = round(self.offset * (1 << fraction_bits))
+        if fraction_bits > 0:
+            offset += 1 << (fraction_bits - 1)
+
+        return fraction_bits, multiplier, offset
+
+
+def parse(path):
+    message = None
+    signals = []
+    comments = {}
+
+    for number, line in enumerate(path.read_text().splitlines(), 1):
+        line = line.strip()
+
+        match = MESSAGE_PATTERN.match(line)
+        if match:
+            if message is not None:
+                raise ValueError(f"line {number}: only one message per description is supported")
+            message = match.group(2)
+            if int(match.group(3)) > FRAME_LENGTH_B:
+                raise ValueError(f"line {number}: message is longer than {FRAME_LENGTH_B} bytes")
+            continue
+
+        match = COMMENT_PATTERN.match(line)
+        if match:
+            comments[match.group(1)] = match.group(2)
+            continue
+
+        if not line.startswith("SG_"):
+            continue
+
+        match = SIGNAL_PATTERN.match(line)
+        if not match:
+            raise ValueError(f"line {number}: can't parse signal")
+
+        name, multiplexing, start_bit, length, byte_order, sign, factor, offset, _, _, unit = match.groups()
+        signal = Signal(name=name, start_bit=int(start_bit), length=int(length), big_endian=byte_order == "0",
+                        signed=sign == "-", factor=Fraction(factor.strip()), offset=Fraction(offset.strip()),
+                        unit=unit)
+        if multiplexing == "M":
+            signal.is_multiplexor = True
+        elif multiplexing:
+            signal.multiplexed_by = int(multiplexing[1:])
+
+        if not 0 < signal.length <= MAX_SIGNAL_LENGTH:
+            raise ValueError(f"line {number}: signal {name} has to be 1 to {MAX_SIGNAL_LENGTH} bits long")
+        signals.append(signal)
+
+    if message is None:
+        raise ValueError("no message found")
+    if not signals:
+        raise ValueError("message has no signals")
+    if len(signals) > MAX_SIGNALS:
+        raise ValueError(f"more than {MAX_SIGNALS} signals")
+    if len({signal.name for signal in signals}) != len(signals):
+        raise ValueError("signal names have to be unique")
+
+    multiplexors = [signal for signal in signals if signal.is_multiplexor]
+    if len(multiplexors) > 1:
+        raise ValueError("only one multiplexor per message is supported")
+    if any(signal.multiplexed_by is not None for signal in signals) and not multiplexors:
+        raise ValueError("multiplexed signals without multiplexor")
+    if any((signal.multiplexed_by or 0) > MAX_MULTIPLEXOR_VALUE for signal in signals):
+        raise ValueError(f"multiplexor values above {MAX_MULTIPLEXOR_VALUE} are not supported")
+
+    for signal in signals:
+        signal.comment = comments.get(signal.name, "")
+
+    return message, signals
+
+
+def describe(signal, index):
+    shift, required_dlc = signal.placement()
+    fraction_bits, multiplier, offset = signal.fixed_point()
+    byte_order = "SIGNAL_BYTE_ORDER_BIG_ENDIAN" if signal.big_endian else "SIGNAL_BYTE_ORDER_LITTLE_ENDIAN"
+    sign_shift = 64 - signal.length if signal.signed else 0
+    mask = (1 << signal.length) - 1
+
+    return (f"\t// {signal.name}: raw * {float(signal.factor):g} + {float(signal.offset):g} {signal.unit}".rstrip() + "\n"
+            f"\t{{{index}, {byte_order}, {shift}, {sign_shift}, {required_dlc}, {fraction_bits}, {multiplier}, "
+            f"{offset}LL, 0x{mask:X}ULL}},\n")
+
+
+def generate(message, signals, name):
+    type_name = f"{name}_t"
+    prefix = re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).upper()
+    table_name = f"g_{name[0].lower()}{name[1:]}DecodeTable"
+    header_name = f"{name}s.h"
+
+    header = [
+        f"// Generated by {Path(__file__).name} from the description of {message}, don't edit\n",
+        "#pragma once\n\n",
+        "// Project includes\n",
+        "#include \"SignalDecoder.h\"\n\n",
+        "/*\n *\tPublic typedefs\n */\n",
+        f"//! \\brief The signals of {message}\n",
+        "typedef enum\n{\n",
+    ]
+    for signal in signals:
+        if signal.comment:
+            header.append(f"\t//! \\brief {signal.comment}\n")
+        header.append(f"\t{prefix}_{signal.enum_name},\n")
+    header += [
+        f"\t{prefix}_AMOUNT\n",
+        f"}} {type_name};\n\n",
+        "/*\n *\tPublic variables\n */\n",
+        f"//! \\brief Decodes {message} with signalDecoderDecode()\n",
+        f"extern const SignalDecodeTable_t {table_name};\n",
+    ]
+
+    plain = [signal for signal in signals if signal.multiplexed_by is None]
+    multiplexor = next((signal for signal in signals if signal.is_multiplexor), None)
+    groups = {}
+    for signal in signals:
+        if signal.multiplexed_by is not None:
+            groups.setdefault(signal.multiplexed_by, []).append(signal)
+    multiplexed_amount = max(groups) + 1 if groups else 0
+
+    source = [
+        f"// Generated by {Path(__file__).name} from the description of {message}, don't edit\n",
+        f"#include \"{header_name}\"\n\n",
+        "// C includes\n",
+        "#include <stddef.h>\n\n",
+        "/*\n *\tPrivate variables\n */\n",
+        "// Signal, byte order, shift, sign shift, required dlc, fraction bits, multiplier, offset, mask\n",
+        "static const SignalDescription_t g_plainSignals[] = {\n",
+    ]
+    source += [describe(signal, f"{prefix}_{signal.enum_name}") for signal in plain]
+    source.append("};\n")
+
+    for value in sorted(groups):
+        source.append(f"\nstatic const SignalDescription_t g_multiplexed{value}Signals[] = {{\n")
+        source += [describe(signal, f"{prefix}_{signal.enum_name}") for signal in groups[value]]
+        source.append("};\n")
+
+    if groups:
+        source.append("\n//! \\brief Indexed by the raw value of the multiplexor\n")
+        source.append(f"static const SignalGroup_t g_multiplexedGroups[{multiplexed_amount}] = {{\n")
+        for value in range(multiplexed_amount):
+            if value in groups:
+                source.append(f"\t{{g_multiplexed{value}Signals, {len(groups[value])}}},\n")
+            else:
+                source.append("\t{NULL, 0},\n")
+        source.append("};\n")
+
+    multiplexor_entry = "NULL"
+    if multiplexor is not None:
+        multiplexor_entry = f"&g_plainSignals[{plain.index(multiplexor)}]"
+
+    source += [
+        "\n/*\n *\tPublic variables\n */\n",
+        f"const SignalDecodeTable_t {table_name} = {{\n",
+        f"\t.plain = {{g_plainSignals, {len(plain)}}},\n",
+        f"\t.p_multiplexor = {multiplexor_entry},\n",
+        f"\t.p_multiplexed = {'g_multiplexedGroups' if groups else 'NULL'},\n",
+        f"\t.multiplexedAmount = {multiplexed_amount},\n",
+        "};\n",
+    ]
+
+    return header_name, "".join(header), f"{name}s.c", "".join(source)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("description", type=Path, help="the DBC signal description")
+    parser.add_argument("output", type=Path, help="directory the header and source are written to")
+    parser.add_argument("--name", default="SensorSignal", help="name of the signal enum, without _t")
+    arguments = parser.parse_args()
+
+    try:
+        message, signals = parse(arguments.description)
+        files = generate(message, signals, arguments.name)
+    except ValueError as error:
+        print(f"{arguments.description}: {error}", file=sys.stderr)
+        return 1
+
+    arguments.output.mkdir(parents=True, exist_ok=True)
+    for file_name, content in zip(files[::2], files[1::2]):
+        path = arguments.output / file_name
+        # Only touch the files if they changed, otherwise everything including them is rebuilt
+        if not path.exists() or path.read_text() != content:
+            path.write_text(content)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())